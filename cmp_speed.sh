@@ -36,6 +36,241 @@ if [ $? -eq 0 ] ; then
     fi
 fi
 
+echo
+# Speed Comparison for concurrent stack (std: std::stack + mutex)
+make re -C ./tests/time_concurrent_stack/ > /dev/null
+if [ $? -eq 0 ] ; then
+    mkdir -p results
+    echo "$(tput setaf 2)Test concurrent stack speed: "
+    echo -n "$(tput sgr0)   ft : "
+    $TIMECMD ./tests/time_concurrent_stack/cstacktime_ft > results/ft_cstack_spd
+    echo -n "$(tput sgr0 2)  std : "
+    $TIMECMD ./tests/time_concurrent_stack/cstacktime_og > results/og_cstack_spd
+    diff results/ft_cstack_spd results/og_cstack_spd -c --color > results/diff_cstack_spd 2>&1
+    if [ $? -eq 0 ] ; then
+        echo "$(tput setaf 2)  Same output"
+    else
+        echo "$(tput setaf 1)  Diff in output, find diff in ./results/"
+    fi
+fi
+
+echo
+# Speed Comparison for concurrent map (std: std::map + mutex)
+make re -C ./tests/time_concurrent_map/ > /dev/null
+if [ $? -eq 0 ] ; then
+    mkdir -p results
+    echo "$(tput setaf 2)Test concurrent map speed: "
+    echo -n "$(tput sgr0)   ft : "
+    $TIMECMD ./tests/time_concurrent_map/cmaptime_ft > results/ft_cmap_spd
+    echo -n "$(tput sgr0 2)  std : "
+    $TIMECMD ./tests/time_concurrent_map/cmaptime_og > results/og_cmap_spd
+    diff results/ft_cmap_spd results/og_cmap_spd -c --color > results/diff_cmap_spd 2>&1
+    if [ $? -eq 0 ] ; then
+        echo "$(tput setaf 2)  Same output"
+    else
+        echo "$(tput setaf 1)  Diff in output, find diff in ./results/"
+    fi
+fi
+
+echo
+# Speed Comparison for persistent map (std: copy of a std::map)
+make re -C ./tests/time_persistent_map/ > /dev/null
+if [ $? -eq 0 ] ; then
+    mkdir -p results
+    echo "$(tput setaf 2)Test persistent map speed: "
+    echo -n "$(tput sgr0)   ft : "
+    $TIMECMD ./tests/time_persistent_map/pmaptime_ft > results/ft_pmap_spd
+    echo -n "$(tput sgr0 2)  std : "
+    $TIMECMD ./tests/time_persistent_map/pmaptime_og > results/og_pmap_spd
+    diff results/ft_pmap_spd results/og_pmap_spd -c --color > results/diff_pmap_spd 2>&1
+    if [ $? -eq 0 ] ; then
+        echo "$(tput setaf 2)  Same output"
+    else
+        echo "$(tput setaf 1)  Diff in output, find diff in ./results/"
+    fi
+fi
+
+echo
+# Speed Comparison for batched lookups (std: loop of std::map::find)
+make re -C ./tests/time_find_batch/ > /dev/null
+if [ $? -eq 0 ] ; then
+    mkdir -p results
+    echo "$(tput setaf 2)Test find_batch speed: "
+    echo -n "$(tput sgr0)   ft : "
+    $TIMECMD ./tests/time_find_batch/fbtime_ft > results/ft_fb_spd
+    echo -n "$(tput sgr0 2)  std : "
+    $TIMECMD ./tests/time_find_batch/fbtime_og > results/og_fb_spd
+    diff results/ft_fb_spd results/og_fb_spd -c --color > results/diff_fb_spd 2>&1
+    if [ $? -eq 0 ] ; then
+        echo "$(tput setaf 2)  Same output"
+    else
+        echo "$(tput setaf 1)  Diff in output, find diff in ./results/"
+    fi
+fi
+
+echo
+# Speed Comparison for interval queries (std: scan of a std::multimap)
+make re -C ./tests/time_interval/ > /dev/null
+if [ $? -eq 0 ] ; then
+    mkdir -p results
+    echo "$(tput setaf 2)Test interval_map speed: "
+    echo -n "$(tput sgr0)   ft : "
+    $TIMECMD ./tests/time_interval/ivtime_ft > results/ft_iv_spd
+    echo -n "$(tput sgr0 2)  std : "
+    $TIMECMD ./tests/time_interval/ivtime_og > results/og_iv_spd
+    diff results/ft_iv_spd results/og_iv_spd -c --color > results/diff_iv_spd 2>&1
+    if [ $? -eq 0 ] ; then
+        echo "$(tput setaf 2)  Same output"
+    else
+        echo "$(tput setaf 1)  Diff in output, find diff in ./results/"
+    fi
+fi
+
+echo
+# Speed Comparison for the balancing policies (std: std::map for each)
+# uniform, sorted and zipf keys, see the times of each policy
+make re -C ./tests/time_balance/ > /dev/null
+if [ $? -eq 0 ] ; then
+    mkdir -p results
+    echo "$(tput setaf 2)Test balancing policies speed: "
+    echo -n "$(tput sgr0)   ft : "
+    $TIMECMD ./tests/time_balance/baltime_ft > results/ft_bal_spd
+    echo -n "$(tput sgr0 2)  std : "
+    $TIMECMD ./tests/time_balance/baltime_og > results/og_bal_spd
+    diff results/ft_bal_spd results/og_bal_spd -c --color > results/diff_bal_spd 2>&1
+    if [ $? -eq 0 ] ; then
+        echo "$(tput setaf 2)  Same output"
+    else
+        echo "$(tput setaf 1)  Diff in output, find diff in ./results/"
+    fi
+fi
+
+echo
+# Speed Comparison for integer keys (std: std::map, int_map against map)
+make re -C ./tests/time_int_map/ > /dev/null
+if [ $? -eq 0 ] ; then
+    mkdir -p results
+    echo "$(tput setaf 2)Test int_map speed: "
+    echo -n "$(tput sgr0)   ft : "
+    $TIMECMD ./tests/time_int_map/imtime_ft > results/ft_im_spd
+    echo -n "$(tput sgr0 2)  std : "
+    $TIMECMD ./tests/time_int_map/imtime_og > results/og_im_spd
+    diff results/ft_im_spd results/og_im_spd -c --color > results/diff_im_spd 2>&1
+    if [ $? -eq 0 ] ; then
+        echo "$(tput setaf 2)  Same output"
+    else
+        echo "$(tput setaf 1)  Diff in output, find diff in ./results/"
+    fi
+fi
+
+echo
+# Speed Comparison for integer sets (std: std::set, int_set against set)
+make re -C ./tests/time_int_set/ > /dev/null
+if [ $? -eq 0 ] ; then
+    mkdir -p results
+    echo "$(tput setaf 2)Test int_set speed: "
+    echo -n "$(tput sgr0)   ft : "
+    $TIMECMD ./tests/time_int_set/istime_ft > results/ft_is_spd
+    echo -n "$(tput sgr0 2)  std : "
+    $TIMECMD ./tests/time_int_set/istime_og > results/og_is_spd
+    diff results/ft_is_spd results/og_is_spd -c --color > results/diff_is_spd 2>&1
+    if [ $? -eq 0 ] ; then
+        echo "$(tput setaf 2)  Same output"
+    else
+        echo "$(tput setaf 1)  Diff in output, find diff in ./results/"
+    fi
+fi
+
+echo
+# Speed Comparison for bit vectors (std: std::vector<bool>, sieve, bulk and shifts)
+make re -C ./tests/time_vector_bool/ > /dev/null
+if [ $? -eq 0 ] ; then
+    mkdir -p results
+    echo "$(tput setaf 2)Test vector<bool> speed: "
+    echo -n "$(tput sgr0)   ft : "
+    $TIMECMD ./tests/time_vector_bool/vbtime_ft > results/ft_vb_spd
+    echo -n "$(tput sgr0 2)  std : "
+    $TIMECMD ./tests/time_vector_bool/vbtime_og > results/og_vb_spd
+    diff results/ft_vb_spd results/og_vb_spd -c --color > results/diff_vb_spd 2>&1
+    if [ $? -eq 0 ] ; then
+        echo "$(tput setaf 2)  Same output"
+    else
+        echo "$(tput setaf 1)  Diff in output, find diff in ./results/"
+    fi
+fi
+
+echo
+# Speed Comparison for field scans (std: std::vector<std::pair>, soa_vector against vector<pair>)
+make re -C ./tests/time_soa_vector/ > /dev/null
+if [ $? -eq 0 ] ; then
+    mkdir -p results
+    echo "$(tput setaf 2)Test soa_vector speed: "
+    echo -n "$(tput sgr0)   ft : "
+    $TIMECMD ./tests/time_soa_vector/svtime_ft > results/ft_sv_spd
+    echo -n "$(tput sgr0 2)  std : "
+    $TIMECMD ./tests/time_soa_vector/svtime_og > results/og_sv_spd
+    diff results/ft_sv_spd results/og_sv_spd -c --color > results/diff_sv_spd 2>&1
+    if [ $? -eq 0 ] ; then
+        echo "$(tput setaf 2)  Same output"
+    else
+        echo "$(tput setaf 1)  Diff in output, find diff in ./results/"
+    fi
+fi
+
+echo
+# Speed Comparison for small temporaries (std: std::vector, static_vector against vector)
+make re -C ./tests/time_static_vector/ > /dev/null
+if [ $? -eq 0 ] ; then
+    mkdir -p results
+    echo "$(tput setaf 2)Test static_vector speed: "
+    echo -n "$(tput sgr0)   ft : "
+    $TIMECMD ./tests/time_static_vector/stvtime_ft > results/ft_stv_spd
+    echo -n "$(tput sgr0 2)  std : "
+    $TIMECMD ./tests/time_static_vector/stvtime_og > results/og_stv_spd
+    diff results/ft_stv_spd results/og_stv_spd -c --color > results/diff_stv_spd 2>&1
+    if [ $? -eq 0 ] ; then
+        echo "$(tput setaf 2)  Same output"
+    else
+        echo "$(tput setaf 1)  Diff in output, find diff in ./results/"
+    fi
+fi
+
+echo
+# Speed Comparison for full scans (std: std::map, nodes threaded or not)
+make re -C ./tests/time_scan/ > /dev/null
+if [ $? -eq 0 ] ; then
+    mkdir -p results
+    echo "$(tput setaf 2)Test scan speed: "
+    echo -n "$(tput sgr0)   ft : "
+    $TIMECMD ./tests/time_scan/scantime_ft > results/ft_scan_spd
+    echo -n "$(tput sgr0 2)  std : "
+    $TIMECMD ./tests/time_scan/scantime_og > results/og_scan_spd
+    diff results/ft_scan_spd results/og_scan_spd -c --color > results/diff_scan_spd 2>&1
+    if [ $? -eq 0 ] ; then
+        echo "$(tput setaf 2)  Same output"
+    else
+        echo "$(tput setaf 1)  Diff in output, find diff in ./results/"
+    fi
+fi
+
+echo
+# Speed Comparison for queues (std: std::queue, + mutex when shared)
+make re -C ./tests/time_queue/ > /dev/null
+if [ $? -eq 0 ] ; then
+    mkdir -p results
+    echo "$(tput setaf 2)Test queue speed: "
+    echo -n "$(tput sgr0)   ft : "
+    $TIMECMD ./tests/time_queue/queuetime_ft > results/ft_queue_spd
+    echo -n "$(tput sgr0 2)  std : "
+    $TIMECMD ./tests/time_queue/queuetime_og > results/og_queue_spd
+    diff results/ft_queue_spd results/og_queue_spd -c --color > results/diff_queue_spd 2>&1
+    if [ $? -eq 0 ] ; then
+        echo "$(tput setaf 2)  Same output"
+    else
+        echo "$(tput setaf 1)  Diff in output, find diff in ./results/"
+    fi
+fi
+
 echo
 # Speed Comparison for map
 make re -C ./tests/time_map/ > /dev/null
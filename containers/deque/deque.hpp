@@ -0,0 +1,597 @@
+#ifndef DEQUE_HPP
+# define DEQUE_HPP
+
+# include <memory> // needed for std::allocator
+# include <algorithm> // needed for std::max
+# include <limits> // needed for deque::max_size()
+# include <stdexcept> // needed for std::out_of_range
+
+// type_traits, contains iterator_traits, enable_if, is_integral
+# include "../utils/type_traits.hpp"
+// relational operators
+# include "../utils/comparisons.hpp"
+// iterators, contains reverse_iterator
+# include "../utils/iterators.hpp"
+// iterators, specific to deque
+# include "deque_iterator.hpp"
+
+namespace ft
+{
+
+/*
+ * Double ended queue
+ *
+ * Elements are stored in fixed-size chunks (see deque_chunk_size),
+ * a chunk map keeps their addresses in order.
+ * Growing at either end allocates at most one chunk and sometimes
+ * reallocates the map (pointers only), elements are never relocated.
+*/
+template <class T, class Alloc = std::allocator<T> > class deque
+{
+public:
+
+    /*
+     * **************************************
+     * ********** Member Types **************
+     * **************************************
+    */
+
+    typedef T       value_type;
+    typedef Alloc   allocator_type;
+
+    typedef typename allocator_type::reference       reference;
+    typedef typename allocator_type::const_reference const_reference;
+    typedef typename allocator_type::pointer         pointer;
+    typedef typename allocator_type::const_pointer   const_pointer;
+
+    typedef typename allocator_type::size_type       size_type;
+    typedef typename allocator_type::difference_type difference_type;
+
+    /*
+     * **************************************
+     * ********* Iterator Types *************
+     * **************************************
+    */
+
+    typedef deque_iterator<value_type, pointer>         iterator;
+    typedef deque_iterator<const value_type, pointer>   const_iterator;
+
+    typedef reverse_iterator<const_iterator>       const_reverse_iterator;
+    typedef reverse_iterator<iterator>             reverse_iterator;
+
+private:
+
+    typedef pointer*                                            map_pointer;
+    typedef typename Alloc::template rebind<pointer>::other     map_allocator_type;
+
+    /*
+     * **************************************
+     * ************ Variables ***************
+     * **************************************
+    */
+
+    allocator_type      _al;        // Allocator for elements
+    map_allocator_type  _map_al;    // Allocator for the chunk map
+    map_pointer         _map;       // Chunk map, NULL until first insertion
+    size_type           _map_sz;    // Number of slots in chunk map
+    iterator            _start;     // First element
+    iterator            _finish;    // Past the last element (always in an allocated chunk)
+
+    /*
+     * **************************************
+     * ********* Private Functions **********
+     * **************************************
+    */
+
+    static size_type _chunk_size() { return deque_chunk_size(sizeof(value_type)); }
+
+    pointer _allocate_chunk() { return _al.allocate(_chunk_size()); }
+    void    _deallocate_chunk(pointer p) { _al.deallocate(p, _chunk_size()); }
+
+    // Creates a map with a single chunk in its middle
+    void _init_map() {
+        _map_sz = 8;
+        _map = _map_al.allocate(_map_sz);
+        map_pointer node = _map + _map_sz / 2;
+        *node = _allocate_chunk();
+        _start._set_node(node);
+        _start._cur = _start._first;
+        _finish = _start;
+    }
+
+    // Makes the chunk map bigger, or recenters it if it's mostly empty
+    void _reallocate_map(size_type nodes_to_add, bool add_at_front) {
+        size_type   old_nodes = _finish._node - _start._node + 1;
+        size_type   new_nodes = old_nodes + nodes_to_add;
+        map_pointer new_start;
+
+        if (_map_sz > 2 * new_nodes) {
+            new_start = _map + (_map_sz - new_nodes) / 2
+                        + (add_at_front ? nodes_to_add : 0);
+            if (new_start < _start._node)
+                for (size_type i = 0; i < old_nodes; i++)
+                    new_start[i] = _start._node[i];
+            else
+                for (size_type i = old_nodes; i > 0; i--)
+                    new_start[i - 1] = _start._node[i - 1];
+        }
+        else {
+            size_type new_map_sz = _map_sz + std::max(_map_sz, nodes_to_add) + 2;
+            map_pointer new_map = _map_al.allocate(new_map_sz);
+            new_start = new_map + (new_map_sz - new_nodes) / 2
+                        + (add_at_front ? nodes_to_add : 0);
+            for (size_type i = 0; i < old_nodes; i++)
+                new_start[i] = _start._node[i];
+            _map_al.deallocate(_map, _map_sz);
+            _map = new_map;
+            _map_sz = new_map_sz;
+        }
+        _start._set_node(new_start);
+        _finish._set_node(new_start + old_nodes - 1);
+    }
+
+    void _reserve_map_at_back(size_type nodes_to_add = 1) {
+        if (nodes_to_add + 1 > _map_sz - (_finish._node - _map))
+            _reallocate_map(nodes_to_add, false);
+    }
+
+    void _reserve_map_at_front(size_type nodes_to_add = 1) {
+        if (nodes_to_add > static_cast<size_type>(_start._node - _map))
+            _reallocate_map(nodes_to_add, true);
+    }
+
+    // Destroys all elements, and keeps only the first chunk
+    void _destroy_all() {
+        for (iterator it = _start; it != _finish; ++it)
+            _al.destroy(it._cur);
+        for (map_pointer node = _start._node + 1; node <= _finish._node; ++node)
+            _deallocate_chunk(*node);
+        _finish = _start;
+    }
+
+    // Destroys and deallocate all deque content
+    void empty_self() {
+        if (!_map)
+            return;
+        _destroy_all();
+        _deallocate_chunk(*_start._node);
+        _map_al.deallocate(_map, _map_sz);
+        _map = NULL;
+        _map_sz = 0;
+        _start = iterator();
+        _finish = iterator();
+    }
+
+    // Makes room for count elements before index, and returns
+    // the iterator of the first slot to overwrite.
+    // The smallest side of the deque is the one that is moved,
+    // slots are filled with copies of the values around them
+    iterator _make_room(size_type index, size_type count) {
+        size_type sz = size();
+        if (index < sz / 2) {
+            for (size_type i = 0; i < count; i++)
+                push_front(front());
+            iterator dst = _start;
+            iterator src = _start + count;
+            for (size_type i = 0; i < index; i++)
+                *dst++ = *src++;
+        }
+        else {
+            for (size_type i = 0; i < count; i++)
+                push_back(back());
+            iterator dst = _finish;
+            iterator src = _finish - count;
+            for (size_type i = sz - index; i > 0; i--)
+                *--dst = *--src;
+        }
+        return _start + index;
+    }
+
+    template <class Ite>
+    size_type _range(Ite first, Ite last){
+        size_type ret = 0;
+        while (first != last){
+            ++first;
+            ++ret;
+        }
+        return ret;
+    }
+
+public:
+
+    /*
+     * **************************************
+     * ********* Member Functions ***********
+     * **************************************
+    */
+
+    // ***** Constructors *****
+
+    // Constructs an empty container, nothing is allocated yet
+    explicit deque(const allocator_type& alloc = allocator_type()):
+        _al(alloc), _map_al(alloc),
+        _map(NULL), _map_sz(0), _start(), _finish(){}
+
+    // Fill
+    explicit deque(size_type n,
+                   const value_type& val = value_type(),
+                   const allocator_type& alloc = allocator_type()):
+        _al(alloc), _map_al(alloc),
+        _map(NULL), _map_sz(0), _start(), _finish()
+    {
+        for (size_type i = 0; i < n; i++)
+            push_back(val);
+    }
+
+    // Range
+    template <class InputIt>
+    deque(typename ft::enable_if<!is_integral<InputIt>::value, InputIt>::type first, InputIt last,
+          const allocator_type& alloc = allocator_type()):
+        _al(alloc), _map_al(alloc),
+        _map(NULL), _map_sz(0), _start(), _finish()
+    {
+        for (; first != last; ++first)
+            push_back(*first);
+    }
+
+    // Copy
+    deque(const deque& cpy):
+        _al(cpy._al), _map_al(cpy._map_al),
+        _map(NULL), _map_sz(0), _start(), _finish()
+    {
+        for (const_iterator it = cpy.begin(); it != cpy.end(); ++it)
+            push_back(*it);
+    }
+
+    // ***** Destructor *****
+    ~deque(){ empty_self(); }
+
+    // ***** Assignment operator *****
+    deque& operator=(const deque& cpy) {
+        if (this != &cpy)
+            assign(cpy.begin(), cpy.end());
+        return *this;
+    }
+
+    // ***** Assign *****
+    void assign(size_type count, const value_type& value) {
+        iterator it = begin();
+        for (; it != end() && count; --count)
+            *it++ = value;
+        if (count)
+            insert(end(), count, value);
+        else
+            erase(it, end());
+    }
+
+    template <class InputIt>
+    void assign(typename ft::enable_if<!is_integral<InputIt>::value, InputIt>::type first, InputIt last) {
+        iterator it = begin();
+        for (; it != end() && first != last; ++first)
+            *it++ = *first;
+        if (first != last)
+            insert(end(), first, last);
+        else
+            erase(it, end());
+    }
+
+    // Get allocator
+    allocator_type get_allocator() const { return _al; }
+
+    /*
+     * **************************************
+     * ************ Iterators ***************
+     * **************************************
+    */
+
+    iterator begin() { return _start; }
+    const_iterator begin() const { return _start; }
+
+    iterator end() { return _finish; }
+    const_iterator end() const { return _finish; }
+
+    reverse_iterator rbegin() { return reverse_iterator(end()); }
+    const_reverse_iterator rbegin() const { return const_reverse_iterator(end()); }
+
+    reverse_iterator rend() { return reverse_iterator(begin()); }
+    const_reverse_iterator rend() const { return const_reverse_iterator(begin()); }
+
+    /*
+     * **************************************
+     * ************* Capacity ***************
+     * **************************************
+    */
+
+    size_type size() const { return _finish - _start; }
+
+    size_type max_size() const {
+        return std::numeric_limits<difference_type>::max() / (sizeof(value_type) / 2 < 1 ? 1 : sizeof(value_type) / 2);
+    }
+
+    bool empty() const { return _start == _finish; }
+
+    void resize(size_type n, value_type val = value_type()) {
+        size_type sz = size();
+        if (n < sz)
+            erase(begin() + n, end());
+        else
+            insert(end(), n - sz, val);
+    }
+
+    // Chunks are released as soon as they're empty,
+    // so only the chunk map can be shrunk (or everything, if empty)
+    void shrink_to_fit() {
+        if (!_map)
+            return;
+        if (empty())
+            return empty_self();
+        size_type   nodes = _finish._node - _start._node + 1;
+        if (_map_sz <= nodes + 2)
+            return;
+        map_pointer new_map = _map_al.allocate(nodes + 2);
+        for (size_type i = 0; i < nodes; i++)
+            new_map[i + 1] = _start._node[i];
+        _map_al.deallocate(_map, _map_sz);
+        _map = new_map;
+        _map_sz = nodes + 2;
+        _start._set_node(new_map + 1);
+        _finish._set_node(new_map + nodes);
+    }
+
+    /*
+     * **************************************
+     * ********** Element Access ************
+     * **************************************
+    */
+
+    reference       operator[](size_type pos)       { return _start[pos]; }
+    const_reference operator[](size_type pos) const { return _start[pos]; }
+
+    reference       at(size_type pos) {
+        if (pos >= size())
+            throw std::out_of_range("deque::_M_range_check");
+        return _start[pos];
+    }
+    const_reference at(size_type pos) const {
+        if (pos >= size())
+            throw std::out_of_range("deque::_M_range_check");
+        return _start[pos];
+    }
+
+    reference       front()       { return *_start; }
+    const_reference front() const { return *_start; }
+
+    reference       back()       { iterator tmp(_finish); return *--tmp; }
+    const_reference back() const { const_iterator tmp(_finish); return *--tmp; }
+
+    /*
+     * **************************************
+     * ************ Modifiers ***************
+     * **************************************
+    */
+
+    // Push back
+    // a new chunk is allocated when the last slot of the current one is used
+    void push_back(const value_type& val) {
+        if (!_map)
+            _init_map();
+        if (_finish._cur != _finish._last - 1) {
+            _al.construct(_finish._cur, val);
+            ++_finish._cur;
+        }
+        else {
+            _reserve_map_at_back();
+            *(_finish._node + 1) = _allocate_chunk();
+            _al.construct(_finish._cur, val);
+            _finish._set_node(_finish._node + 1);
+            _finish._cur = _finish._first;
+        }
+    }
+
+    // Push front
+    void push_front(const value_type& val) {
+        if (!_map)
+            _init_map();
+        if (_start._cur != _start._first) {
+            _al.construct(_start._cur - 1, val);
+            --_start._cur;
+        }
+        else {
+            _reserve_map_at_front();
+            *(_start._node - 1) = _allocate_chunk();
+            _start._set_node(_start._node - 1);
+            _start._cur = _start._last - 1;
+            _al.construct(_start._cur, val);
+        }
+    }
+
+    // Pop back, releases the chunk left empty
+    void pop_back() {
+        if (_finish._cur != _finish._first)
+            --_finish._cur;
+        else {
+            _deallocate_chunk(_finish._first);
+            _finish._set_node(_finish._node - 1);
+            _finish._cur = _finish._last - 1;
+        }
+        _al.destroy(_finish._cur);
+    }
+
+    // Pop front, releases the chunk left empty
+    void pop_front() {
+        _al.destroy(_start._cur);
+        if (_start._cur != _start._last - 1)
+            ++_start._cur;
+        else {
+            _deallocate_chunk(_start._first);
+            _start._set_node(_start._node + 1);
+            _start._cur = _start._first;
+        }
+    }
+
+    // Inserts value before pos
+    iterator insert(iterator pos, const value_type& value) {
+        size_type index = pos - begin();
+        if (index == 0) {
+            push_front(value);
+            return begin();
+        }
+        if (index == size()) {
+            push_back(value);
+            return end() - 1;
+        }
+        iterator it = _make_room(index, 1);
+        *it = value;
+        return it;
+    }
+
+    // Inserts count copies of the value before pos
+    void insert(iterator pos, size_type count, const value_type& value) {
+        size_type index = pos - begin();
+        if (index == size())
+            while (count--)
+                push_back(value);
+        else if (index == 0)
+            while (count--)
+                push_front(value);
+        else {
+            iterator it = _make_room(index, count);
+            while (count--)
+                *it++ = value;
+        }
+    }
+
+    // Insert all the element between first and last at pos
+    template <class InputIt>
+    void insert(iterator pos,
+                typename ft::enable_if<!is_integral<InputIt>::value, InputIt>::type first,
+                InputIt last)
+    {
+        _insert_pv(pos, first, last,
+                   typename iterator_traits<InputIt>::iterator_category());
+    }
+
+private:
+    // Only an input_iterator, the range is copied first to know its size
+    template <class InputIt>
+    void _insert_pv(iterator pos, InputIt first, InputIt last, std::input_iterator_tag) {
+        deque tmp(first, last);
+        insert(pos, tmp.begin(), tmp.end());
+    }
+
+    template <class InputIt>
+    void _insert_pv(iterator pos, InputIt first, InputIt last, std::forward_iterator_tag) {
+        size_type index = pos - begin();
+        size_type count = _range(first, last);
+        if (!count)
+            return;
+        if (index == size())
+            for (; first != last; ++first)
+                push_back(*first);
+        else {
+            iterator it = _make_room(index, count);
+            for (; first != last; ++first)
+                *it++ = *first;
+        }
+    }
+
+public:
+    // removes the element at pos
+    iterator erase(iterator pos) {
+        return erase(pos, pos + 1);
+    }
+
+    // removes the elements in range [first, last),
+    // moving the smallest side of the deque
+    iterator erase(iterator first, iterator last) {
+        size_type index = first - begin();
+        size_type count = last - first;
+        if (!count)
+            return first;
+        if (index < (size() - count) / 2) {
+            iterator dst = last;
+            iterator src = first;
+            for (size_type i = index; i > 0; i--)
+                *--dst = *--src;
+            while (count--)
+                pop_front();
+        }
+        else {
+            for (; last != end(); ++first, ++last)
+                *first = *last;
+            while (count--)
+                pop_back();
+        }
+        return begin() + index;
+    }
+
+    void swap(deque& x) {
+        map_pointer tmp_map = x._map;
+        size_type   tmp_map_sz = x._map_sz;
+        iterator    tmp_start = x._start;
+        iterator    tmp_finish = x._finish;
+
+        x._map = _map;
+        x._map_sz = _map_sz;
+        x._start = _start;
+        x._finish = _finish;
+
+        _map = tmp_map;
+        _map_sz = tmp_map_sz;
+        _start = tmp_start;
+        _finish = tmp_finish;
+    }
+
+    void clear() { if (_map) _destroy_all(); }
+
+};
+
+
+/*
+ * **************************************
+ * ********** Relational Ope ************
+ * **************************************
+*/
+
+template <class T, class Alloc>
+bool operator==(const deque<T, Alloc>& lhs,
+                const deque<T, Alloc>& rhs) {
+    if (lhs.size() != rhs.size())
+        return false;
+    return ft::equal(lhs.begin(), lhs.end(), rhs.begin());
+}
+
+template <class T, class Alloc>
+bool operator!=(const deque<T, Alloc>& lhs,
+                const deque<T, Alloc>& rhs) {
+    return !(lhs == rhs);
+}
+
+template <class T, class Alloc>
+bool operator<(const deque<T, Alloc>& lhs,
+               const deque<T, Alloc>& rhs) {
+    return ft::lexicographical_compare(lhs.begin(), lhs.end(),
+                                       rhs.begin(), rhs.end());
+}
+
+template <class T, class Alloc>
+bool operator>(const deque<T, Alloc>& lhs,
+               const deque<T, Alloc>& rhs) {
+    return rhs < lhs;
+}
+
+template <class T, class Alloc>
+bool operator<=(const deque<T, Alloc>& lhs,
+                const deque<T, Alloc>& rhs) {
+    return !(rhs < lhs);
+}
+
+template <class T, class Alloc>
+bool operator>=(const deque<T, Alloc>& lhs,
+                const deque<T, Alloc>& rhs) {
+    return !(lhs < rhs);
+}
+
+}
+
+#endif
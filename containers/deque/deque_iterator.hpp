@@ -0,0 +1,183 @@
+#ifndef DEQUE_ITERATOR_HPP
+# define DEQUE_ITERATOR_HPP
+
+// needed for iterator_traits
+# include "../utils/type_traits.hpp"
+
+namespace ft
+{
+
+// Number of elements stored in each deque chunk,
+// chunks are kept around 4KiB, with at least 16 elements
+inline std::size_t deque_chunk_size(std::size_t elem_size) {
+    return elem_size < 256 ? 4096 / elem_size : 16;
+}
+
+// T is the (maybe const) value_type, chunk_type is value_type*
+// so both iterator and const_iterator walk the same chunk map
+template <class T, class chunk_type> class deque_iterator
+{
+    public:
+    // iterator_traits
+    typedef T                               value_type;
+    typedef ptrdiff_t                       difference_type;
+    typedef T*                              pointer;
+    typedef T&                              reference;
+    typedef std::random_access_iterator_tag iterator_category;
+
+    typedef chunk_type*                     map_pointer;
+
+    // Variables are public so that deque can move them
+    // from one chunk to the other
+    pointer     _cur;   // position
+    pointer     _first; // start of current chunk
+    pointer     _last;  // end of current chunk
+    map_pointer _node;  // current chunk in chunk map
+
+    static difference_type _chunk_size() {
+        return static_cast<difference_type>(deque_chunk_size(sizeof(T)));
+    }
+
+    // Jumps to an other chunk, _cur has to be set afterwards
+    void _set_node(map_pointer new_node) {
+        _node = new_node;
+        _first = *new_node;
+        _last = _first + _chunk_size();
+    }
+
+    public:
+    // Const conversion
+    operator deque_iterator<const T, chunk_type> () const {
+        return (deque_iterator<const T, chunk_type>(_cur, _first, _last, _node));
+    }
+
+    // Constructors
+    deque_iterator():_cur(NULL), _first(NULL), _last(NULL), _node(NULL){}
+    deque_iterator(deque_iterator const &it):
+        _cur(it._cur), _first(it._first), _last(it._last), _node(it._node){}
+
+    deque_iterator(pointer cur, pointer first, pointer last, map_pointer node):
+        _cur(cur), _first(first), _last(last), _node(node){}
+
+    // Assignement operator
+    deque_iterator& operator=(const deque_iterator& it){
+        _cur = it._cur;
+        _first = it._first;
+        _last = it._last;
+        _node = it._node;
+        return *this;
+    }
+
+    // Member access operators
+    reference operator * () const {return *_cur;}
+    reference operator [] (difference_type n) const {return *(*this + n);}
+    pointer   operator -> () const {return _cur;}
+
+    // Pre-Increment/Decrement (++i)
+    deque_iterator& operator++() {
+        ++_cur;
+        if (_cur == _last) {
+            _set_node(_node + 1);
+            _cur = _first;
+        }
+        return *this;
+    }
+    deque_iterator& operator--() {
+        if (_cur == _first) {
+            _set_node(_node - 1);
+            _cur = _last;
+        }
+        --_cur;
+        return *this;
+    }
+
+    // Post-Increment/Decrement (i++)
+    deque_iterator operator++(int) {deque_iterator copy(*this); ++*this; return copy;}
+    deque_iterator operator--(int) {deque_iterator copy(*this); --*this; return copy;}
+
+    // Arithmetic Assignement operators
+    // stays in the same chunk if possible, else jumps directly to the right one
+    deque_iterator& operator+=(difference_type n) {
+        difference_type offset = n + (_cur - _first);
+        if (offset >= 0 && offset < _chunk_size())
+            _cur += n;
+        else {
+            difference_type node_offset = offset > 0 ?
+                offset / _chunk_size() :
+                -((-offset - 1) / _chunk_size()) - 1;
+            _set_node(_node + node_offset);
+            _cur = _first + (offset - node_offset * _chunk_size());
+        }
+        return *this;
+    }
+    deque_iterator& operator-=(difference_type n) { return *this += -n; }
+
+    // Arithmetic operators
+    deque_iterator operator+(difference_type n) const{ deque_iterator ret(*this); return ret += n; }
+    deque_iterator operator-(difference_type n) const{ deque_iterator ret(*this); return ret -= n; }
+    difference_type operator-(deque_iterator const &it) const{
+        if (!_node)
+            return 0;
+        return _chunk_size() * (_node - it._node - 1)
+            + (_cur - _first) + (it._last - it._cur);
+    }
+
+    // Comparison operators
+    bool operator==(deque_iterator const &it) const { return _cur == it._cur; }
+    bool operator!=(deque_iterator const &it) const { return _cur != it._cur; }
+
+    bool operator<(deque_iterator const &it) const {
+        return _node == it._node ? _cur < it._cur : _node < it._node;
+    }
+    bool operator>(deque_iterator const &it) const { return it < *this; }
+
+    bool operator<=(deque_iterator const &it) const { return !(it < *this); }
+    bool operator>=(deque_iterator const &it) const { return !(*this < it); }
+
+    // Needed for const comparisons
+    pointer base() const {
+        return _cur;
+    }
+};
+
+// Outside class definitions //
+
+// const_iterator and iterator comparisons
+/* for iterator == const_iterator */
+template<typename T_L, typename T_R, typename C>
+bool operator==(const deque_iterator<T_L, C> lhs,
+          const deque_iterator<T_R, C> rhs) {
+    return (lhs.base() == rhs.base());
+}
+
+/* for iterator != const_iterator */
+template<typename T_L, typename T_R, typename C>
+bool operator!=(const deque_iterator<T_L, C> lhs,
+          const deque_iterator<T_R, C> rhs) {
+    return (lhs.base() != rhs.base());
+}
+
+/* for iterator < const_iterator */
+template<typename T_L, typename T_R, typename C>
+bool operator<(const deque_iterator<T_L, C> lhs,
+          const deque_iterator<T_R, C> rhs) {
+    return lhs._node == rhs._node ? lhs._cur < rhs._cur : lhs._node < rhs._node;
+}
+
+/* for iterator - const_iterator */
+template<typename T_L, typename T_R, typename C>
+typename deque_iterator<T_L, C>::difference_type
+operator-(const deque_iterator<T_L, C> lhs,
+          const deque_iterator<T_R, C> rhs) {
+    return deque_iterator<const T_L, C>(lhs) - deque_iterator<const T_L, C>(rhs);
+}
+
+// operator+ with difference_type as lhs
+template <class T, class C>
+deque_iterator<T, C>
+operator+(typename deque_iterator<T, C>::difference_type n, deque_iterator<T, C> it) {
+    deque_iterator<T, C> ret(it + n); return ret;
+}
+
+}
+#endif
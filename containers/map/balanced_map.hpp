@@ -0,0 +1,172 @@
+#ifndef BALANCED_MAP_HPP
+# define BALANCED_MAP_HPP
+
+# include "../utils/bs_tree.hpp"  // the tree and its balancing policies
+# include "../utils/pair.hpp"     // needed for ft::pair and ft::make_pair
+
+# include <memory>    // needed for std::allocator
+
+namespace ft {
+
+/*
+ * map on another balancing than red/black (see tree_balance.hpp):
+ *
+ *     avl_map    shallower tree, for lookup heavy tables
+ *     treap_map  random priorities, simple and no data in the nodes
+ *     splay_map  recently used keys near the root, for skewed accesses
+ *
+ * Same interface and iterators as map, without its extras (node
+ * handles, split/join, set algebra, batches). Any other policy can be
+ * given to balanced_map.
+*/
+template <
+    class Key,
+    class T,
+    class Balance,
+    class Compare = std::less<Key>,
+    class Alloc = std::allocator<ft::pair<const Key, T> >
+> class balanced_map : public bs_tree<Key, ft::pair<const Key, T>,
+                                      select_first<ft::pair<const Key, T> >,
+                                      Balance, Compare, Alloc> {
+    typedef bs_tree<Key, ft::pair<const Key, T>,
+                    select_first<ft::pair<const Key, T> >,
+                    Balance, Compare, Alloc>  tree_type;
+
+    public:
+
+    /*
+     * **************************************
+     * ********** Member Types **************
+     * **************************************
+    */
+
+    typedef Key                     key_type;
+    typedef T                       mapped_type;
+    typedef ft::pair<const Key, T>  value_type;
+
+    typedef std::ptrdiff_t          difference_type;
+    typedef std::size_t             size_type;
+    typedef Alloc                   allocator_type;
+    typedef value_type&             reference;
+    typedef const value_type&       const_reference;
+
+    typedef typename Alloc::pointer       pointer;
+    typedef typename Alloc::const_pointer const_pointer;
+
+    typedef Compare                                 key_compare;
+    typedef typename tree_type::value_compare       value_compare;
+
+    typedef typename tree_type::iterator                iterator;
+    typedef typename tree_type::const_iterator          const_iterator;
+    typedef typename tree_type::reverse_iterator        reverse_iterator;
+    typedef typename tree_type::const_reverse_iterator  const_reverse_iterator;
+
+    /*
+     * **************************************
+     * ********* Member Functions ***********
+     * **************************************
+    */
+
+    // ***** Constructors *****
+    //
+    // Default
+    explicit balanced_map (const key_compare& comp = key_compare(),
+                           const allocator_type& alloc = allocator_type()) :
+        tree_type(comp, alloc) {}
+
+    // Range
+    template< class InputIt >
+    balanced_map (InputIt first, InputIt last,
+                  const key_compare& comp = key_compare(),
+                  const allocator_type& alloc = allocator_type()) :
+        tree_type(comp, alloc)
+    { this->insert(first, last); }
+
+    // Copy
+    balanced_map (const balanced_map & cpy): tree_type(cpy) {}
+
+
+    // ***** Destructor *****
+    ~balanced_map() {}
+
+
+    // ***** Assignment operator *****
+    balanced_map& operator=(const balanced_map& other){
+        tree_type::operator=(other);
+        return *this;
+    }
+
+    /*
+     * **************************************
+     * ********** Element access ************
+     * **************************************
+    */
+
+    // ***** operator[] *****
+
+    mapped_type& operator[] (const key_type& k){
+        return (*((this->insert(ft::make_pair(k,mapped_type()))).first)).second;
+    }
+
+};  // --------- End of balanced_map
+
+
+// ***** The policies of tree_balance.hpp *****
+
+template <
+    class Key,
+    class T,
+    class Compare = std::less<Key>,
+    class Alloc = std::allocator<ft::pair<const Key, T> >
+> class avl_map : public balanced_map<Key, T, avl_balance, Compare, Alloc> {
+    typedef balanced_map<Key, T, avl_balance, Compare, Alloc>  base_type;
+
+    public:
+    explicit avl_map (const Compare& comp = Compare(), const Alloc& alloc = Alloc()) :
+        base_type(comp, alloc) {}
+
+    template< class InputIt >
+    avl_map (InputIt first, InputIt last,
+             const Compare& comp = Compare(), const Alloc& alloc = Alloc()) :
+        base_type(first, last, comp, alloc) {}
+};
+
+template <
+    class Key,
+    class T,
+    class Compare = std::less<Key>,
+    class Alloc = std::allocator<ft::pair<const Key, T> >
+> class treap_map : public balanced_map<Key, T, treap_balance, Compare, Alloc> {
+    typedef balanced_map<Key, T, treap_balance, Compare, Alloc>  base_type;
+
+    public:
+    explicit treap_map (const Compare& comp = Compare(), const Alloc& alloc = Alloc()) :
+        base_type(comp, alloc) {}
+
+    template< class InputIt >
+    treap_map (InputIt first, InputIt last,
+               const Compare& comp = Compare(), const Alloc& alloc = Alloc()) :
+        base_type(first, last, comp, alloc) {}
+};
+
+template <
+    class Key,
+    class T,
+    class Compare = std::less<Key>,
+    class Alloc = std::allocator<ft::pair<const Key, T> >
+> class splay_map : public balanced_map<Key, T, splay_balance, Compare, Alloc> {
+    typedef balanced_map<Key, T, splay_balance, Compare, Alloc>  base_type;
+
+    public:
+    explicit splay_map (const Compare& comp = Compare(), const Alloc& alloc = Alloc()) :
+        base_type(comp, alloc) {}
+
+    template< class InputIt >
+    splay_map (InputIt first, InputIt last,
+               const Compare& comp = Compare(), const Alloc& alloc = Alloc()) :
+        base_type(first, last, comp, alloc) {}
+};
+
+} // --------- End of ft namespace
+
+#endif
@@ -0,0 +1,478 @@
+#ifndef CONCURRENT_MAP_HPP
+# define CONCURRENT_MAP_HPP
+
+# include "../utils/pair.hpp"   // needed for ft::pair and ft::make_pair
+# include "../utils/atomic.hpp" // atomic builtins wrappers
+# include "../utils/epoch.hpp"  // memory reclamation
+
+# include <new>         // needed for operator new
+# include <functional>  // needed for std::less
+# include <cstddef>     // needed for size_t
+
+namespace ft {
+
+/*
+ * Ordered map shared between threads (lazy concurrent skip list)
+ *
+ * - Readers (find, lower_bound, iteration) never lock nor write
+ *   shared memory, they just follow the next pointers.
+ * - Writers lock only the nodes around the key they insert or erase,
+ *   so writers on different parts of the map don't wait on each other.
+ *   An erased node is first marked, then unlinked, then retired to the
+ *   epoch reclamation (epoch.hpp) which frees it when no reader can
+ *   still be on it.
+ *
+ * Elements can't be modified in place (a reader could be copying them),
+ * so iterators are const. An iterator keeps its thread in an epoch read
+ * section while it lives: it must stay in the thread that created it,
+ * and shouldn't be kept for long as it delays memory reclamation.
+*/
+template <
+    class Key,
+    class T,
+    class Compare = std::less<Key>
+> class concurrent_map {
+    public:
+
+    /*
+     * **************************************
+     * ********** Member Types **************
+     * **************************************
+    */
+
+    typedef Key                     key_type;
+    typedef T                       mapped_type;
+    typedef ft::pair<const Key, T>  value_type;
+
+    typedef std::ptrdiff_t          difference_type;
+    typedef std::size_t             size_type;
+    typedef const value_type&       reference;
+    typedef const value_type&       const_reference;
+    typedef Compare                 key_compare;
+
+private:
+
+    // Levels of the skip list, each one holds about 1/4th of the one below
+    static const int max_level = 16;
+
+    // ***** skip list node *****
+    // allocated in one block: the node, its tower of next pointers,
+    // and the value
+    struct node_type : public epoch_node {
+        value_type *            val;        // NULL for the head
+        int                     height;     // number of levels linked
+        volatile int            lock;       // spinlock, held by writers
+        volatile int            marked;     // logically erased
+        volatile int            linked;     // inserted at every level
+        node_type * volatile    next[1];    // tower, height long
+    };
+
+    static std::size_t _value_offset(int height) {
+        std::size_t sz = sizeof(node_type) + (height - 1) * sizeof(node_type *);
+        return (sz + 15) & ~static_cast<std::size_t>(15);
+    }
+
+    static node_type *_new_node(int height, const value_type *x) {
+        void        *mem = ::operator new(_value_offset(height) + (x ? sizeof(value_type) : 0));
+        node_type   *n = static_cast<node_type *>(mem);
+
+        n->retired_next = NULL;
+        n->reclaim = _reclaim;
+        n->val = NULL;
+        n->height = height;
+        n->lock = 0;
+        n->marked = 0;
+        n->linked = 0;
+        for (int i = 0; i < height; i++)
+            n->next[i] = NULL;
+        if (x) {
+            try {
+                n->val = new (static_cast<char *>(mem) + _value_offset(height)) value_type(*x);
+            }
+            catch (...) { ::operator delete(mem); throw; }
+        }
+        return n;
+    }
+
+    static void _delete_node(node_type *n) {
+        if (n->val)
+            n->val->~value_type();
+        ::operator delete(n);
+    }
+
+    // called by the epoch reclamation
+    static void _reclaim(epoch_node *n) { _delete_node(static_cast<node_type *>(n)); }
+
+    static void _lock(node_type *n) {
+        backoff wait;
+        while (atomic_exchange(&n->lock, 1, mo_acquire))
+            wait();
+    }
+
+    static void _unlock(node_type *n) { atomic_store(&n->lock, 0); }
+
+    // Random height: 1 with probability 3/4, 2 with 3/16...
+    static int _random_height() {
+        static __thread unsigned int seed = 0;
+        if (!seed)
+            seed = static_cast<unsigned int>(reinterpret_cast<std::size_t>(&seed)) | 1;
+        seed ^= seed << 13;
+        seed ^= seed >> 17;
+        seed ^= seed << 5;
+        int h = 1;
+        unsigned int r = seed;
+        while (h < max_level && (r & 3) == 0) {
+            ++h;
+            r >>= 2;
+        }
+        return h;
+    }
+
+public:
+
+    /*
+     * **************************************
+     * ************ Iterator ****************
+     * **************************************
+    */
+
+    // Forward iterator on the bottom level, skipping erased nodes
+    class const_iterator {
+        friend class concurrent_map;
+
+        node_type *_ptr;
+
+        explicit const_iterator(node_type *p): _ptr(p) { epoch::enter(); }
+
+        public:
+        typedef const ft::pair<const Key, T>     value_type;
+        typedef std::ptrdiff_t                   difference_type;
+        typedef const value_type*                pointer;
+        typedef const value_type&                reference;
+        typedef std::forward_iterator_tag        iterator_category;
+
+        const_iterator(): _ptr(NULL) { epoch::enter(); }
+        const_iterator(const const_iterator &it): _ptr(it._ptr) { epoch::enter(); }
+        ~const_iterator() { epoch::exit(); }
+
+        const_iterator& operator=(const const_iterator &it) { _ptr = it._ptr; return *this; }
+
+        reference operator * () const { return *_ptr->val; }
+        pointer   operator -> () const { return _ptr->val; }
+
+        const_iterator& operator++() {
+            _ptr = _skip(atomic_load(&_ptr->next[0]));
+            return *this;
+        }
+        const_iterator operator++(int) { const_iterator copy(*this); ++*this; return copy; }
+
+        bool operator==(const const_iterator &it) const { return _ptr == it._ptr; }
+        bool operator!=(const const_iterator &it) const { return _ptr != it._ptr; }
+    };
+
+    typedef const_iterator iterator;
+
+    friend class const_iterator;
+
+    /*
+     * **************************************
+     * ************ Variables ***************
+     * **************************************
+    */
+
+private:
+    node_type *             _head;  // sentinel, lower than any key
+    const key_compare       _cmp_k;
+    volatile size_type      _sz;
+
+    // Not copyable, a copy couldn't be made atomically
+    concurrent_map(const concurrent_map &);
+    concurrent_map& operator=(const concurrent_map &);
+
+    // first node from n that is fully inserted and not erased
+    static node_type *_skip(node_type *n) {
+        while (n && (atomic_load(&n->marked) || !atomic_load(&n->linked)))
+            n = atomic_load(&n->next[0]);
+        return n;
+    }
+
+    bool _less(node_type *n, const key_type &k) const { return _cmp_k(n->val->first, k); }
+    bool _equal(node_type *n, const key_type &k) const {
+        return n && !_cmp_k(k, n->val->first);
+    }
+
+    // Fills the nodes before and after k at every level,
+    // returns the highest level where k was found, or -1
+    int _find(const key_type &k, node_type **preds, node_type **succs) const {
+        int         found = -1;
+        node_type   *pred = _head;
+
+        for (int level = max_level - 1; level >= 0; --level) {
+            node_type *cur = atomic_load(&pred->next[level]);
+            while (cur && _less(cur, k)) {
+                pred = cur;
+                cur = atomic_load(&pred->next[level]);
+            }
+            if (found == -1 && _equal(cur, k))
+                found = level;
+            preds[level] = pred;
+            succs[level] = cur;
+        }
+        return found;
+    }
+
+    // first node not less than k, erased nodes included
+    node_type *_lower_bound(const key_type &k) const {
+        node_type *pred = _head;
+        node_type *cur = NULL;
+
+        for (int level = max_level - 1; level >= 0; --level) {
+            cur = atomic_load(&pred->next[level]);
+            while (cur && _less(cur, k)) {
+                pred = cur;
+                cur = atomic_load(&pred->next[level]);
+            }
+        }
+        return cur;
+    }
+
+    // Unlocks the distinct preds locked up to level highest
+    static void _unlock_preds(node_type **preds, int highest) {
+        for (int level = 0; level <= highest; ++level)
+            if (!level || preds[level] != preds[level - 1])
+                _unlock(preds[level]);
+    }
+
+public:
+
+    /*
+     * **************************************
+     * ********* Member Functions ***********
+     * **************************************
+    */
+
+    // ***** Constructors *****
+    explicit concurrent_map(const key_compare& comp = key_compare()):
+        _head(_new_node(max_level, NULL)),
+        _cmp_k(comp),
+        _sz(0)
+    { _head->linked = 1; }
+
+    // ***** Destructor *****
+    // No other thread may use the map anymore
+    ~concurrent_map() {
+        node_type *n = _head;
+        while (n) {
+            node_type *next = n->next[0];
+            _delete_node(n);
+            n = next;
+        }
+    }
+
+    /*
+     * **************************************
+     * ************* Iterator ***************
+     * **************************************
+    */
+
+    const_iterator begin() const {
+        epoch_guard g;
+        return const_iterator(_skip(atomic_load(&_head->next[0])));
+    }
+
+    const_iterator end() const { return const_iterator(NULL); }
+
+    /*
+     * **************************************
+     * ************* Capacity ***************
+     * **************************************
+    */
+
+    // Only snapshots when other threads are writing
+    bool empty() const { return begin() == end(); }
+
+    size_type size() const { return atomic_load(&_sz, mo_relaxed); }
+
+    /*
+     * **************************************
+     * ************ Modifiers ***************
+     * **************************************
+    */
+
+    // ***** Insert *****
+    // Locks the predecessors of the new node bottom up, checks they
+    // still point to the successors found, then links the node
+    ft::pair<const_iterator, bool> insert(const value_type &x) {
+        epoch_guard g;
+        node_type   *preds[max_level];
+        node_type   *succs[max_level];
+        node_type   *n = NULL;
+        int         height = _random_height();
+
+        while (true) {
+            int found = _find(x.first, preds, succs);
+            if (found != -1) {
+                node_type *cur = succs[found];
+                if (!atomic_load(&cur->marked)) {
+                    // being inserted by an other thread, wait for it
+                    backoff wait;
+                    while (!atomic_load(&cur->linked))
+                        wait();
+                    if (n)
+                        _delete_node(n);
+                    return ft::make_pair(const_iterator(cur), false);
+                }
+                // being erased, try again once it's unlinked
+                continue;
+            }
+            int         highest = -1;
+            bool        valid = true;
+            node_type   *prev = NULL;
+            for (int level = 0; valid && level < height; ++level) {
+                node_type *pred = preds[level];
+                node_type *succ = succs[level];
+                if (pred != prev) {
+                    _lock(pred);
+                    highest = level;
+                    prev = pred;
+                }
+                valid = !atomic_load(&pred->marked)
+                        && (!succ || !atomic_load(&succ->marked))
+                        && atomic_load(&pred->next[level]) == succ;
+            }
+            if (!valid) {
+                _unlock_preds(preds, highest);
+                continue;
+            }
+            if (!n) {
+                try { n = _new_node(height, &x); }
+                catch (...) { _unlock_preds(preds, highest); throw; }
+            }
+            for (int level = 0; level < height; ++level)
+                n->next[level] = succs[level];
+            for (int level = 0; level < height; ++level)
+                atomic_store(&preds[level]->next[level], n);
+            atomic_store(&n->linked, 1);
+            _unlock_preds(preds, highest);
+            atomic_fetch_add(&_sz, static_cast<size_type>(1), mo_relaxed);
+            return ft::make_pair(const_iterator(n), true);
+        }
+    }
+
+    // Insert range
+    template< class InputIt >
+    void insert( InputIt first, InputIt last ){
+        for (; first != last; ++first)
+            insert(*first);
+    }
+
+    // ***** erase *****
+    // Marks the node, then unlinks it top down under the predecessors locks
+    size_type erase(const key_type &k) {
+        epoch_guard g;
+        node_type   *preds[max_level];
+        node_type   *succs[max_level];
+        node_type   *victim = NULL;
+        int         height = 0;
+
+        while (true) {
+            int found = _find(k, preds, succs);
+            if (!victim) {
+                if (found == -1)
+                    return 0;
+                node_type *cur = succs[found];
+                // only erase nodes fully inserted, found at their top level
+                if (!atomic_load(&cur->linked) || cur->height - 1 != found
+                    || atomic_load(&cur->marked))
+                    return 0;
+                victim = cur;
+                height = victim->height;
+                _lock(victim);
+                if (atomic_load(&victim->marked)) {
+                    _unlock(victim);
+                    return 0;
+                }
+                atomic_store(&victim->marked, 1);
+            }
+            int         highest = -1;
+            bool        valid = true;
+            node_type   *prev = NULL;
+            for (int level = 0; valid && level < height; ++level) {
+                node_type *pred = preds[level];
+                if (pred != prev) {
+                    _lock(pred);
+                    highest = level;
+                    prev = pred;
+                }
+                valid = !atomic_load(&pred->marked)
+                        && atomic_load(&pred->next[level]) == victim;
+            }
+            if (!valid) {
+                _unlock_preds(preds, highest);
+                continue;
+            }
+            for (int level = height - 1; level >= 0; --level)
+                atomic_store(&preds[level]->next[level], atomic_load(&victim->next[level]));
+            _unlock(victim);
+            _unlock_preds(preds, highest);
+            atomic_fetch_sub(&_sz, static_cast<size_type>(1), mo_relaxed);
+            epoch::retire(victim);
+            return 1;
+        }
+    }
+
+    // ***** clear *****
+    // Erases elements one by one, others threads can keep working
+    void clear() {
+        for (const_iterator it = begin(); it != end(); it = begin())
+            erase(it->first);
+    }
+
+    /*
+     * **************************************
+     * ************** Lookup ****************
+     * **************************************
+    */
+
+    // ***** find *****
+    const_iterator find(const key_type &k) const {
+        epoch_guard g;
+        node_type   *n = _lower_bound(k);
+        if (_equal(n, k) && atomic_load(&n->linked) && !atomic_load(&n->marked))
+            return const_iterator(n);
+        return end();
+    }
+
+    // ***** count *****
+    size_type count(const key_type &k) const { return find(k) != end(); }
+
+    // ***** lower_bound *****
+    // first element not less than k
+    const_iterator lower_bound(const key_type &k) const {
+        epoch_guard g;
+        return const_iterator(_skip(_lower_bound(k)));
+    }
+
+    // ***** upper_bound *****
+    // first element greater than k
+    const_iterator upper_bound(const key_type &k) const {
+        epoch_guard g;
+        node_type *n = _skip(_lower_bound(k));
+        if (_equal(n, k))
+            n = _skip(atomic_load(&n->next[0]));
+        return const_iterator(n);
+    }
+
+    /*
+     * **************************************
+     * ************ Observers ***************
+     * **************************************
+    */
+
+    key_compare key_comp() const { return _cmp_k; }
+
+};  // --------- End of concurrent_map
+
+} // --------- End of ft namespace
+
+#endif
@@ -0,0 +1,1061 @@
+#ifndef INT_MAP_HPP
+# define INT_MAP_HPP
+
+# include "../utils/comparisons.hpp" // needed relational operators
+# include "../utils/pair.hpp"       // needed for ft::pair and ft::make_pair
+# include "../utils/iterators.hpp" // needed for reverse iterator
+# include "../utils/type_traits.hpp" // needed for is_integral
+# include "../utils/int_key.hpp"   // keys as unsigned numbers
+
+# include <memory>      // needed for std::allocator
+# include <new>         // needed for placement new
+# include <functional>  // needed for std::less
+# include <cstring>     // needed for memmove
+
+# ifdef __SSE2__
+#  include <emmintrin.h> // node16 searches
+# endif
+
+namespace ft {
+
+/*
+ * Ordered map of integer keys, as an adaptive radix tree (ART)
+ *
+ * Keys are read one byte at a time from the most significant one (the
+ * sign bit flipped, so that the bytes sort like the numbers). An inner
+ * node picks its child from one byte, in one of four layouts growing
+ * with the number of children: 4 and 16 sorted bytes (16 compared at
+ * once with SSE2), an index of 256 bytes to 48 children, or 256
+ * children. A node also skips the bytes all its keys share (its
+ * prefix), so the tree is never deeper than the key is long, and
+ * usually much less on dense or clustered keys: a lookup is a few
+ * byte indexed hops instead of a comparison per tree level.
+ *
+ * A key and its value are in a leaf, leaves are also linked in order:
+ * iterating is following a list, O(1) per step.
+ *
+ * Same interface as map, ordered by std::less<Key>.
+*/
+template <
+    class Key,
+    class T,
+    class Alloc = std::allocator<ft::pair<const Key, T> >
+> class int_map {
+    typedef char key_must_be_integral[ft::is_integral<Key>::value ? 1 : -1];
+
+    public:
+
+    /*
+     * **************************************
+     * ********** Member Types **************
+     * **************************************
+    */
+
+    typedef Key                     key_type;
+    typedef T                       mapped_type;
+    typedef ft::pair<const Key, T>  value_type;
+
+    typedef std::ptrdiff_t          difference_type;
+    typedef std::size_t             size_type;
+    typedef Alloc                   allocator_type;
+    typedef value_type&             reference;
+    typedef const value_type&       const_reference;
+
+    typedef typename Alloc::pointer       pointer;
+    typedef typename Alloc::const_pointer const_pointer;
+
+    typedef std::less<Key>          key_compare;
+
+    //Class that compares 2 objects of value_type
+    class value_compare :
+    public std::binary_function<value_type, value_type, bool> {
+        friend class int_map;
+        protected:
+        value_compare () {}
+        public:
+        typedef bool result_type;
+        typedef value_type first_argument_type;
+        typedef value_type second_argument_type;
+        bool operator() (const value_type& x, const value_type& y) const {
+            return x.first < y.first;
+        }
+    };
+
+private:
+    // ***** leaves *****
+    // the end() link is the first and last of the list
+    struct link_type {
+        link_type * prev;
+        link_type * next;
+    };
+
+    struct leaf_type : link_type {
+        value_type  val;
+    };
+
+    typedef typename Alloc::template rebind<leaf_type>::other   leaf_allocator_type;
+
+    // ***** inner nodes *****
+    // children are inner nodes, or leaves with the low bit set
+    typedef typename int_key<Key>::bits_type   bits_type;  // key as an unsigned number
+    typedef unsigned char       byte_type;
+
+    enum { key_bytes = sizeof(Key) };
+    enum kind_type { node4, node16, node48, node256 };
+
+    struct inner_type {
+        byte_type       kind;
+        byte_type       prefix_len;
+        unsigned short  count;
+        byte_type       prefix[key_bytes];  // bytes skipped before the child byte
+
+        inner_type(kind_type k): kind(k), prefix_len(0), count(0) {}
+    };
+
+    typedef inner_type *    child_type;
+
+    struct node4_type : inner_type {
+        byte_type   keys[4];
+        child_type  child[4];
+
+        node4_type(): inner_type(node4) {}
+    };
+
+    struct node16_type : inner_type {
+        byte_type   keys[16];
+        child_type  child[16];
+
+        node16_type(): inner_type(node16) {}
+    };
+
+    // index[b] is 1 + the place of b's child, 0 if none
+    struct node48_type : inner_type {
+        byte_type   index[256];
+        child_type  child[48];
+
+        node48_type(): inner_type(node48) { std::memset(index, 0, sizeof(index)); }
+    };
+
+    struct node256_type : inner_type {
+        child_type  child[256];
+
+        node256_type(): inner_type(node256) { std::memset(child, 0, sizeof(child)); }
+    };
+
+public:
+
+    /*
+     * **************************************
+     * ************ Iterators ***************
+     * **************************************
+    */
+
+    class const_iterator;
+
+    class iterator {
+        friend class int_map;
+        friend class const_iterator;
+
+        link_type * _ptr;
+
+        public:
+        typedef ft::pair<const Key, T>          value_type;
+        typedef std::ptrdiff_t                  difference_type;
+        typedef value_type*                     pointer;
+        typedef value_type&                     reference;
+        typedef std::bidirectional_iterator_tag iterator_category;
+
+        iterator(): _ptr(NULL) {}
+        iterator(link_type *p): _ptr(p) {}
+
+        reference operator * () const { return static_cast<leaf_type *>(_ptr)->val; }
+        pointer   operator -> () const { return &static_cast<leaf_type *>(_ptr)->val; }
+
+        iterator& operator++() { _ptr = _ptr->next; return *this; }
+        iterator  operator++(int) { iterator copy(*this); ++*this; return copy; }
+        iterator& operator--() { _ptr = _ptr->prev; return *this; }
+        iterator  operator--(int) { iterator copy(*this); --*this; return copy; }
+
+        friend bool operator==(const iterator &a, const iterator &b) { return a._ptr == b._ptr; }
+        friend bool operator!=(const iterator &a, const iterator &b) { return a._ptr != b._ptr; }
+    };
+
+    class const_iterator {
+        friend class int_map;
+
+        const link_type *   _ptr;
+
+        public:
+        typedef const ft::pair<const Key, T>    value_type;
+        typedef std::ptrdiff_t                  difference_type;
+        typedef value_type*                     pointer;
+        typedef value_type&                     reference;
+        typedef std::bidirectional_iterator_tag iterator_category;
+
+        const_iterator(): _ptr(NULL) {}
+        const_iterator(const link_type *p): _ptr(p) {}
+        const_iterator(const iterator &it): _ptr(it._ptr) {}
+
+        reference operator * () const { return static_cast<const leaf_type *>(_ptr)->val; }
+        pointer   operator -> () const { return &static_cast<const leaf_type *>(_ptr)->val; }
+
+        const_iterator& operator++() { _ptr = _ptr->next; return *this; }
+        const_iterator  operator++(int) { const_iterator copy(*this); ++*this; return copy; }
+        const_iterator& operator--() { _ptr = _ptr->prev; return *this; }
+        const_iterator  operator--(int) { const_iterator copy(*this); --*this; return copy; }
+
+        friend bool operator==(const const_iterator &a, const const_iterator &b) { return a._ptr == b._ptr; }
+        friend bool operator!=(const const_iterator &a, const const_iterator &b) { return a._ptr != b._ptr; }
+    };
+
+    typedef ft::reverse_iterator<iterator>          reverse_iterator;
+    typedef ft::reverse_iterator<const_iterator>    const_reverse_iterator;
+
+    /*
+     * **************************************
+     * ************ Variables ***************
+     * **************************************
+    */
+
+private:
+    child_type              _root;  // NULL when empty
+    link_type               _end;   // end(), between the last and the first leaf
+    allocator_type          _al;
+    leaf_allocator_type     _lal;
+    size_type               _sz;
+
+    /*
+     * **************************************
+     * ********* Private Functions **********
+     * **************************************
+    */
+
+    // ***** keys *****
+    static bits_type _bits(const key_type &k) { return int_key<Key>::to_bits(k); }
+
+    // byte i of the key, 0 is the most significant
+    static byte_type _byte(bits_type b, unsigned i) {
+        return static_cast<byte_type>(b >> (8 * (key_bytes - 1 - i)));
+    }
+
+    // ***** children *****
+    static bool         _is_leaf(child_type c) { return reinterpret_cast<std::size_t>(c) & 1; }
+    static leaf_type *  _leaf(child_type c) {
+        return reinterpret_cast<leaf_type *>(reinterpret_cast<std::size_t>(c) & ~static_cast<std::size_t>(1));
+    }
+    static child_type   _child(leaf_type *l) {
+        return reinterpret_cast<child_type>(reinterpret_cast<std::size_t>(l) | 1);
+    }
+
+    // slot of the child for b, NULL if none
+    static child_type * _find_child(inner_type *n, byte_type b) {
+        switch (n->kind) {
+        case node4: {
+            node4_type *n4 = static_cast<node4_type *>(n);
+            for (unsigned i = 0; i < n->count; ++i)
+                if (n4->keys[i] == b)
+                    return &n4->child[i];
+            return NULL;
+        }
+        case node16: {
+            node16_type *n16 = static_cast<node16_type *>(n);
+# ifdef __SSE2__
+            __m128i cmp = _mm_cmpeq_epi8(_mm_set1_epi8(static_cast<char>(b)),
+                                         _mm_loadu_si128(reinterpret_cast<__m128i *>(n16->keys)));
+            unsigned mask = _mm_movemask_epi8(cmp) & ((1u << n->count) - 1);
+            return mask ? &n16->child[__builtin_ctz(mask)] : NULL;
+# else
+            for (unsigned i = 0; i < n->count; ++i)
+                if (n16->keys[i] == b)
+                    return &n16->child[i];
+            return NULL;
+# endif
+        }
+        case node48: {
+            node48_type *n48 = static_cast<node48_type *>(n);
+            return n48->index[b] ? &n48->child[n48->index[b] - 1] : NULL;
+        }
+        default: {
+            node256_type *n256 = static_cast<node256_type *>(n);
+            return n256->child[b] ? &n256->child[b] : NULL;
+        }
+        }
+    }
+
+    // child of the smallest byte above b, NULL if none
+    static child_type _next_child(inner_type *n, byte_type b) {
+        switch (n->kind) {
+        case node4: {
+            node4_type *n4 = static_cast<node4_type *>(n);
+            for (unsigned i = 0; i < n->count; ++i)
+                if (n4->keys[i] > b)
+                    return n4->child[i];
+            return NULL;
+        }
+        case node16: {
+            node16_type *n16 = static_cast<node16_type *>(n);
+# ifdef __SSE2__
+            // SSE2 compares signed bytes: both sides are shifted by 128
+            __m128i bias = _mm_set1_epi8(static_cast<char>(0x80));
+            __m128i keys = _mm_xor_si128(_mm_loadu_si128(reinterpret_cast<__m128i *>(n16->keys)), bias);
+            __m128i key = _mm_xor_si128(_mm_set1_epi8(static_cast<char>(b)), bias);
+            unsigned mask = _mm_movemask_epi8(_mm_cmpgt_epi8(keys, key)) & ((1u << n->count) - 1);
+            return mask ? n16->child[__builtin_ctz(mask)] : NULL;
+# else
+            for (unsigned i = 0; i < n->count; ++i)
+                if (n16->keys[i] > b)
+                    return n16->child[i];
+            return NULL;
+# endif
+        }
+        case node48: {
+            node48_type *n48 = static_cast<node48_type *>(n);
+            for (unsigned i = b + 1; i < 256; ++i)
+                if (n48->index[i])
+                    return n48->child[n48->index[i] - 1];
+            return NULL;
+        }
+        default: {
+            node256_type *n256 = static_cast<node256_type *>(n);
+            for (unsigned i = b + 1; i < 256; ++i)
+                if (n256->child[i])
+                    return n256->child[i];
+            return NULL;
+        }
+        }
+    }
+
+    // child of the largest byte below b, NULL if none
+    static child_type _prev_child(inner_type *n, byte_type b) {
+        switch (n->kind) {
+        case node4:
+        case node16: {
+            byte_type *keys = n->kind == node4 ? static_cast<node4_type *>(n)->keys
+                                               : static_cast<node16_type *>(n)->keys;
+            child_type *child = n->kind == node4 ? static_cast<node4_type *>(n)->child
+                                                 : static_cast<node16_type *>(n)->child;
+            for (unsigned i = n->count; i > 0; --i)
+                if (keys[i - 1] < b)
+                    return child[i - 1];
+            return NULL;
+        }
+        case node48: {
+            node48_type *n48 = static_cast<node48_type *>(n);
+            for (unsigned i = b; i > 0; --i)
+                if (n48->index[i - 1])
+                    return n48->child[n48->index[i - 1] - 1];
+            return NULL;
+        }
+        default: {
+            node256_type *n256 = static_cast<node256_type *>(n);
+            for (unsigned i = b; i > 0; --i)
+                if (n256->child[i - 1])
+                    return n256->child[i - 1];
+            return NULL;
+        }
+        }
+    }
+
+    // first and last leaves under c
+    static leaf_type *_min_leaf(child_type c) {
+        while (!_is_leaf(c))
+            c = _first_child(c);
+        return _leaf(c);
+    }
+
+    static leaf_type *_max_leaf(child_type c) {
+        while (!_is_leaf(c))
+            c = _last_child(c);
+        return _leaf(c);
+    }
+
+    static child_type _first_child(inner_type *n) {
+        switch (n->kind) {
+        case node4:     return static_cast<node4_type *>(n)->child[0];
+        case node16:    return static_cast<node16_type *>(n)->child[0];
+        default:        return _next_or_at(n, 0);
+        }
+    }
+
+    static child_type _last_child(inner_type *n) {
+        switch (n->kind) {
+        case node4:     return static_cast<node4_type *>(n)->child[n->count - 1];
+        case node16:    return static_cast<node16_type *>(n)->child[n->count - 1];
+        default: {
+            child_type *at = _find_child(n, 255);
+            return at ? *at : _prev_child(n, 255);
+        }
+        }
+    }
+
+    // child of b, or of the smallest byte above it
+    static child_type _next_or_at(inner_type *n, byte_type b) {
+        child_type *at = _find_child(n, b);
+        return at ? *at : _next_child(n, b);
+    }
+
+    // ***** inner nodes *****
+    // allocated with Alloc, rebound to each layout
+    template <class Node>
+    Node *_new_inner() {
+        typename Alloc::template rebind<Node>::other al(_al);
+        return new (al.allocate(1)) Node();
+    }
+
+    template <class Node>
+    void _free_inner(Node *n) {
+        typename Alloc::template rebind<Node>::other al(_al);
+        al.deallocate(n, 1);
+    }
+
+    // ***** growing and shrinking *****
+    // Nodes are allocated before anything is changed: when that throws,
+    // the tree is left as it was.
+    //
+    // c goes under n for b, n is replaced in slot by a larger node if full
+    void _add_child(child_type *slot, inner_type *n, byte_type b, child_type c) {
+        switch (n->kind) {
+        case node4: {
+            node4_type *n4 = static_cast<node4_type *>(n);
+            if (n->count < 4)
+                return _insert_sorted(n4->keys, n4->child, n->count++, b, c);
+            node16_type *n16 = _new_inner<node16_type>();
+            _copy_header(n16, n);
+            std::memcpy(n16->keys, n4->keys, 4);
+            std::memcpy(n16->child, n4->child, 4 * sizeof(child_type));
+            _free_inner(n4);
+            *slot = n16;
+            return _add_child(slot, n16, b, c);
+        }
+        case node16: {
+            node16_type *n16 = static_cast<node16_type *>(n);
+            if (n->count < 16)
+                return _insert_sorted(n16->keys, n16->child, n->count++, b, c);
+            node48_type *n48 = _new_inner<node48_type>();
+            _copy_header(n48, n);
+            for (unsigned i = 0; i < 16; ++i){
+                n48->child[i] = n16->child[i];
+                n48->index[n16->keys[i]] = static_cast<byte_type>(i + 1);
+            }
+            _free_inner(n16);
+            *slot = n48;
+            return _add_child(slot, n48, b, c);
+        }
+        case node48: {
+            node48_type *n48 = static_cast<node48_type *>(n);
+            if (n->count < 48){
+                n48->child[n->count] = c;
+                n48->index[b] = static_cast<byte_type>(++n->count);
+                return;
+            }
+            node256_type *n256 = _new_inner<node256_type>();
+            _copy_header(n256, n);
+            for (unsigned i = 0; i < 256; ++i)
+                if (n48->index[i])
+                    n256->child[i] = n48->child[n48->index[i] - 1];
+            _free_inner(n48);
+            *slot = n256;
+            return _add_child(slot, n256, b, c);
+        }
+        default:
+            static_cast<node256_type *>(n)->child[b] = c;
+            ++n->count;
+        }
+    }
+
+    static void _insert_sorted(byte_type *keys, child_type *child, unsigned count,
+                               byte_type b, child_type c) {
+        unsigned i = count;
+        for (; i > 0 && keys[i - 1] > b; --i){
+            keys[i] = keys[i - 1];
+            child[i] = child[i - 1];
+        }
+        keys[i] = b;
+        child[i] = c;
+    }
+
+    static void _copy_header(inner_type *to, const inner_type *from) {
+        to->prefix_len = from->prefix_len;
+        to->count = from->count;
+        std::memcpy(to->prefix, from->prefix, key_bytes);
+    }
+
+    // removes b's child from n, n is replaced in slot by a smaller
+    // node when it gets too empty, or by its child if it's the last one
+    void _remove_child(child_type *slot, inner_type *n, byte_type b) {
+        switch (n->kind) {
+        case node4:
+        case node16: {
+            node4_type *n4 = n->kind == node16 && n->count == 4 ? _new_inner<node4_type>() : NULL;
+            byte_type *keys = n->kind == node4 ? static_cast<node4_type *>(n)->keys
+                                               : static_cast<node16_type *>(n)->keys;
+            child_type *child = n->kind == node4 ? static_cast<node4_type *>(n)->child
+                                                 : static_cast<node16_type *>(n)->child;
+            unsigned i = 0;
+            while (keys[i] != b)
+                ++i;
+            --n->count;
+            std::memmove(keys + i, keys + i + 1, n->count - i);
+            std::memmove(child + i, child + i + 1, (n->count - i) * sizeof(child_type));
+            if (n->kind == node4 && n->count == 1)
+                _collapse(slot, static_cast<node4_type *>(n));
+            else if (n4){
+                _copy_header(n4, n);
+                std::memcpy(n4->keys, keys, 3);
+                std::memcpy(n4->child, child, 3 * sizeof(child_type));
+                _free_inner(static_cast<node16_type *>(n));
+                *slot = n4;
+            }
+            return;
+        }
+        case node48: {
+            node48_type *n48 = static_cast<node48_type *>(n);
+            node16_type *n16 = n->count == 13 ? _new_inner<node16_type>() : NULL;
+            unsigned i = n48->index[b] - 1;
+            n48->index[b] = 0;
+            --n->count;
+            if (i != n->count){
+                // the last child fills the hole
+                n48->child[i] = n48->child[n->count];
+                for (unsigned k = 0; k < 256; ++k)
+                    if (n48->index[k] == n->count + 1){
+                        n48->index[k] = static_cast<byte_type>(i + 1);
+                        break;
+                    }
+            }
+            if (n16){
+                _copy_header(n16, n);
+                for (unsigned k = 0, j = 0; k < 256; ++k)
+                    if (n48->index[k]){
+                        n16->keys[j] = static_cast<byte_type>(k);
+                        n16->child[j++] = n48->child[n48->index[k] - 1];
+                    }
+                _free_inner(n48);
+                *slot = n16;
+            }
+            return;
+        }
+        default: {
+            node256_type *n256 = static_cast<node256_type *>(n);
+            node48_type *n48 = n->count == 41 ? _new_inner<node48_type>() : NULL;
+            n256->child[b] = NULL;
+            --n->count;
+            if (n48){
+                _copy_header(n48, n);
+                for (unsigned k = 0, j = 0; k < 256; ++k)
+                    if (n256->child[k]){
+                        n48->child[j] = n256->child[k];
+                        n48->index[k] = static_cast<byte_type>(++j);
+                    }
+                _free_inner(n256);
+                *slot = n48;
+            }
+        }
+        }
+    }
+
+    // a node4 left with one child is replaced by it, an inner child
+    // takes the prefix and the byte of n in front of its own prefix
+    void _collapse(child_type *slot, node4_type *n) {
+        child_type c = n->child[0];
+        if (!_is_leaf(c)){
+            byte_type prefix[key_bytes];
+            unsigned len = n->prefix_len;
+            std::memcpy(prefix, n->prefix, len);
+            prefix[len++] = n->keys[0];
+            std::memcpy(prefix + len, c->prefix, c->prefix_len);
+            len += c->prefix_len;
+            std::memcpy(c->prefix, prefix, len);
+            c->prefix_len = static_cast<byte_type>(len);
+        }
+        _free_inner(n);
+        *slot = c;
+    }
+
+    void _delete_inner(inner_type *n) {
+        switch (n->kind) {
+        case node4:     _free_inner(static_cast<node4_type *>(n)); break;
+        case node16:    _free_inner(static_cast<node16_type *>(n)); break;
+        case node48:    _free_inner(static_cast<node48_type *>(n)); break;
+        default:        _free_inner(static_cast<node256_type *>(n));
+        }
+    }
+
+    // inner nodes only, leaves are freed from the list
+    void _destroy(child_type c) {
+        if (!c || _is_leaf(c))
+            return;
+        switch (c->kind) {
+        case node4:
+            for (unsigned i = 0; i < c->count; ++i)
+                _destroy(static_cast<node4_type *>(c)->child[i]);
+            break;
+        case node16:
+            for (unsigned i = 0; i < c->count; ++i)
+                _destroy(static_cast<node16_type *>(c)->child[i]);
+            break;
+        case node48:
+            for (unsigned i = 0; i < c->count; ++i)
+                _destroy(static_cast<node48_type *>(c)->child[i]);
+            break;
+        default:
+            for (unsigned i = 0; i < 256; ++i)
+                _destroy(static_cast<node256_type *>(c)->child[i]);
+        }
+        _delete_inner(c);
+    }
+
+    // ***** leaves *****
+    leaf_type *_new_leaf(const value_type &x) {
+        leaf_type *l = _lal.allocate(1);
+        try { _al.construct(&l->val, x); }
+        catch (...) { _lal.deallocate(l, 1); throw; }
+        return l;
+    }
+
+    void _delete_leaf(leaf_type *l) {
+        _al.destroy(&l->val);
+        _lal.deallocate(l, 1);
+    }
+
+    // the node4 above the new leaf l, l is freed if it can't be made
+    node4_type *_new_node4(leaf_type *l) {
+        try { return _new_inner<node4_type>(); }
+        catch (...) { _delete_leaf(l); throw; }
+    }
+
+    static void _link_before(link_type *l, link_type *pos) {
+        l->prev = pos->prev;
+        l->next = pos;
+        pos->prev->next = l;
+        pos->prev = l;
+    }
+
+    static void _link_after(link_type *l, link_type *pos) { _link_before(l, pos->next); }
+
+    static void _unlink(link_type *l) {
+        l->prev->next = l->next;
+        l->next->prev = l->prev;
+    }
+
+    void _reset_end() {
+        _root = NULL;
+        _end.prev = &_end;
+        _end.next = &_end;
+    }
+
+    // ***** descents *****
+    // leaf of k, NULL if none. The prefixes aren't checked on the way
+    // down, the key of the leaf is
+    leaf_type *_find_leaf(bits_type k) const {
+        child_type c = _root;
+        unsigned depth = 0;
+        while (c && !_is_leaf(c)){
+            depth += c->prefix_len;
+            child_type *at = _find_child(c, _byte(k, depth++));
+            c = at ? *at : NULL;
+        }
+        if (c && _bits(_leaf(c)->val.first) == k)
+            return _leaf(c);
+        return NULL;
+    }
+
+    // first leaf not below k, end() if none
+    link_type *_lower_leaf(bits_type k) const {
+        child_type c = _root;
+        unsigned depth = 0;
+        if (!c)
+            return const_cast<link_type *>(&_end);
+        while (!_is_leaf(c)){
+            for (unsigned i = 0; i < c->prefix_len; ++i){
+                byte_type kb = _byte(k, depth + i);
+                if (c->prefix[i] != kb)     // all of c is after or before k
+                    return c->prefix[i] > kb ? _min_leaf(c) : _max_leaf(c)->next;
+            }
+            depth += c->prefix_len;
+            byte_type b = _byte(k, depth++);
+            child_type *at = _find_child(c, b);
+            if (!at){
+                child_type next = _next_child(c, b);
+                return next ? _min_leaf(next) : _max_leaf(_prev_child(c, b))->next;
+            }
+            c = *at;
+        }
+        leaf_type *l = _leaf(c);
+        return _bits(l->val.first) >= k ? l : l->next;
+    }
+
+    /*
+     * **************************************
+     * ********* Member Functions ***********
+     * **************************************
+    */
+
+public:
+
+    // ***** Constructors *****
+    //
+    // Default
+    explicit int_map (const key_compare& comp = key_compare(),
+                      const allocator_type& alloc = allocator_type()) :
+        _al(alloc), _lal(alloc), _sz(0)
+    { (void)comp; _reset_end(); }
+
+    // Range
+    template< class InputIt >
+    int_map (InputIt first, InputIt last,
+             const key_compare& comp = key_compare(),
+             const allocator_type& alloc = allocator_type()) :
+        _al(alloc), _lal(alloc), _sz(0)
+    { (void)comp; _reset_end(); insert(first, last); }
+
+    // Copy
+    int_map (const int_map & cpy): _al(cpy._al), _lal(cpy._lal), _sz(0)
+    { _reset_end(); insert(cpy.begin(), cpy.end()); }
+
+
+    // ***** Destructor *****
+    ~int_map() { clear(); }
+
+
+    // ***** Assignment operator *****
+    int_map& operator=(const int_map& other){
+        if (&other != this){
+            clear();
+            insert(other.begin(), other.end());
+        }
+        return *this;
+    }
+
+    // ***** Get_allocator *****
+    allocator_type get_allocator() const { return _al; }
+
+    /*
+     * **************************************
+     * ************* Iterator ***************
+     * **************************************
+    */
+
+    iterator begin() { return iterator(_end.next); }
+    const_iterator begin() const { return const_iterator(_end.next); }
+    iterator end() { return iterator(&_end); }
+    const_iterator end() const { return const_iterator(&_end); }
+
+    reverse_iterator rbegin() { return reverse_iterator(end()); }
+    const_reverse_iterator rbegin() const { return const_reverse_iterator(end()); }
+    reverse_iterator rend() { return reverse_iterator(begin()); }
+    const_reverse_iterator rend() const { return const_reverse_iterator(begin()); }
+
+    /*
+     * **************************************
+     * ************* Capacity ***************
+     * **************************************
+    */
+
+    bool empty() const { return !_sz; }
+
+    size_type size() const { return _sz; }
+
+    size_type max_size() const { return _lal.max_size(); }
+
+    /*
+     * **************************************
+     * ********** Element access ************
+     * **************************************
+    */
+
+    mapped_type& operator[] (const key_type& k){
+        return (*((this->insert(ft::make_pair(k,mapped_type()))).first)).second;
+    }
+
+    /*
+     * **************************************
+     * ************ Modifiers ***************
+     * **************************************
+    */
+
+    // ***** Clear *****
+    void clear(){
+        _destroy(_root);
+        for (link_type *l = _end.next; l != &_end; ){
+            link_type *next = l->next;
+            _delete_leaf(static_cast<leaf_type *>(l));
+            l = next;
+        }
+        _sz = 0;
+        _reset_end();
+    }
+
+    // ***** Insert *****
+    // The leaf and the nodes it needs are allocated before the list and
+    // the tree are changed: an insert that throws changes nothing
+    ft::pair<iterator, bool> insert(const value_type & x){
+        bits_type k = _bits(x.first);
+        child_type *slot = &_root;
+        unsigned depth = 0;
+
+        if (!_root){
+            leaf_type *l = _new_leaf(x);
+            _root = _child(l);
+            _link_before(l, &_end);
+            ++_sz;
+            return ft::make_pair(iterator(l), true);
+        }
+        for (;;){
+            child_type c = *slot;
+            if (_is_leaf(c)){
+                // two leaves under a new node, after the bytes they share
+                leaf_type *old = _leaf(c);
+                bits_type ok = _bits(old->val.first);
+                if (ok == k)
+                    return ft::make_pair(iterator(old), false);
+                leaf_type *l = _new_leaf(x);
+                node4_type *n = _new_node4(l);
+                unsigned d = depth;
+                for (; _byte(ok, d) == _byte(k, d); ++d)
+                    n->prefix[d - depth] = _byte(k, d);
+                n->prefix_len = static_cast<byte_type>(d - depth);
+                _insert_sorted(n->keys, n->child, n->count++, _byte(ok, d), c);
+                _insert_sorted(n->keys, n->child, n->count++, _byte(k, d), _child(l));
+                *slot = n;
+                if (k < ok)
+                    _link_before(l, old);
+                else
+                    _link_after(l, old);
+                ++_sz;
+                return ft::make_pair(iterator(l), true);
+            }
+            unsigned p = 0;
+            while (p < c->prefix_len && c->prefix[p] == _byte(k, depth + p))
+                ++p;
+            if (p < c->prefix_len){
+                // k leaves the prefix of c: a new node above it, for
+                // the bytes they share
+                leaf_type *l = _new_leaf(x);
+                node4_type *n = _new_node4(l);
+                byte_type cb = c->prefix[p];
+                byte_type kb = _byte(k, depth + p);
+                std::memcpy(n->prefix, c->prefix, p);
+                n->prefix_len = static_cast<byte_type>(p);
+                c->prefix_len = static_cast<byte_type>(c->prefix_len - p - 1);
+                std::memmove(c->prefix, c->prefix + p + 1, c->prefix_len);
+                if (kb < cb)
+                    _link_before(l, _min_leaf(c));
+                else
+                    _link_after(l, _max_leaf(c));
+                _insert_sorted(n->keys, n->child, n->count++, cb, c);
+                _insert_sorted(n->keys, n->child, n->count++, kb, _child(l));
+                *slot = n;
+                ++_sz;
+                return ft::make_pair(iterator(l), true);
+            }
+            depth += c->prefix_len;
+            byte_type b = _byte(k, depth);
+            child_type *at = _find_child(c, b);
+            if (!at){
+                // its neighbours are found before c may be replaced
+                child_type next = _next_child(c, b);
+                link_type *pos = next ? _min_leaf(next) : _max_leaf(_prev_child(c, b))->next;
+                leaf_type *l = _new_leaf(x);
+                try { _add_child(slot, c, b, _child(l)); }
+                catch (...) { _delete_leaf(l); throw; }
+                _link_before(l, pos);
+                ++_sz;
+                return ft::make_pair(iterator(l), true);
+            }
+            slot = at;
+            ++depth;
+        }
+    }
+
+    // Insert hint
+    iterator insert(iterator pos, const value_type & x){
+        (void)pos;
+        return insert(x).first;
+    }
+
+    // Insert range
+    template< class InputIt >
+    void insert( InputIt first, InputIt last ){
+        for (; first != last; ++first)
+            insert(*first);
+    }
+
+    // ***** erase *****
+    size_type erase(const key_type & key){
+        bits_type k = _bits(key);
+        child_type *slot = &_root;
+        child_type *parent_slot = NULL;
+        byte_type parent_byte = 0;
+        unsigned depth = 0;
+
+        while (*slot && !_is_leaf(*slot)){
+            depth += (*slot)->prefix_len;
+            byte_type b = _byte(k, depth++);
+            child_type *at = _find_child(*slot, b);
+            if (!at)
+                return 0;
+            parent_slot = slot;
+            parent_byte = b;
+            slot = at;
+        }
+        if (!*slot || _bits(_leaf(*slot)->val.first) != k)
+            return 0;
+        // the tree first: a smaller node may be allocated, if it throws
+        // the leaf is still there
+        leaf_type *l = _leaf(*slot);
+        if (parent_slot)
+            _remove_child(parent_slot, *parent_slot, parent_byte);
+        else
+            _root = NULL;
+        _unlink(l);
+        _delete_leaf(l);
+        --_sz;
+        return 1;
+    }
+
+    void erase(iterator pos){
+        erase(pos->first);
+    }
+
+    void erase(iterator first, iterator last){
+        while (first != last)
+            erase(first++);
+    }
+
+    // ***** swap *****
+    // the end() links stay in their map, the leaves next to them are told
+    void swap(int_map& other){
+        if (&other == this)
+            return;
+        child_type root = _root;
+        link_type end = _end;
+        size_type sz = _sz;
+        _root = other._root;
+        _end = other._end;
+        _sz = other._sz;
+        other._root = root;
+        other._end = end;
+        other._sz = sz;
+        _relink_end();
+        other._relink_end();
+    }
+
+private:
+    void _relink_end(){
+        if (!_sz)
+            return _reset_end();
+        _end.next->prev = &_end;
+        _end.prev->next = &_end;
+    }
+
+public:
+    /*
+     * **************************************
+     * ************** Lookup ****************
+     * **************************************
+    */
+
+    size_type count(const key_type & k) const { return _find_leaf(_bits(k)) ? 1 : 0; }
+
+    iterator       find(const key_type & k) {
+        leaf_type *l = _find_leaf(_bits(k));
+        return l ? iterator(l) : end();
+    }
+
+    const_iterator find(const key_type & k) const {
+        leaf_type *l = _find_leaf(_bits(k));
+        return l ? const_iterator(l) : end();
+    }
+
+    // returns the first element that isn't less than k, or end() if none is found
+    iterator       lower_bound (const key_type& k){ return iterator(_lower_leaf(_bits(k))); }
+
+    const_iterator lower_bound (const key_type& k) const { return const_iterator(_lower_leaf(_bits(k))); }
+
+    // returns the first element that would go after k, or end() if none is found
+    iterator       upper_bound (const key_type& k){
+        iterator it = lower_bound(k);
+        if (it != end() && it->first == k)
+            ++it;
+        return it;
+    }
+
+    const_iterator upper_bound (const key_type& k) const {
+        const_iterator it = lower_bound(k);
+        if (it != end() && it->first == k)
+            ++it;
+        return it;
+    }
+
+    ft::pair<iterator,iterator> equal_range (const key_type& k){
+        return ft::make_pair(lower_bound(k), upper_bound(k));
+    }
+
+    ft::pair<const_iterator,const_iterator> equal_range (const key_type& k) const{
+        return ft::make_pair(lower_bound(k), upper_bound(k));
+    }
+
+    /*
+     * **************************************
+     * ************ Observers ***************
+     * **************************************
+    */
+
+    key_compare   key_comp()   const { return key_compare(); }
+    value_compare value_comp() const { return value_compare(); }
+
+};  // --------- End of int_map
+
+
+    /*
+     * **************************************
+     * ** Non member - Relational operator **
+     * **************************************
+    */
+
+template< class Key, class T, class Alloc >
+bool operator==( const ft::int_map<Key, T, Alloc>& lhs,
+                 const ft::int_map<Key, T, Alloc>& rhs ){
+    return lhs.size() == rhs.size() && ft::equal(lhs.begin(), lhs.end(), rhs.begin());
+}
+
+template< class Key, class T, class Alloc >
+bool operator!=( const ft::int_map<Key, T, Alloc>& lhs,
+                 const ft::int_map<Key, T, Alloc>& rhs ){
+    return !(lhs == rhs);
+}
+
+template< class Key, class T, class Alloc >
+bool operator<( const ft::int_map<Key, T, Alloc>& lhs,
+                const ft::int_map<Key, T, Alloc>& rhs ){
+    return ft::lexicographical_compare(lhs.begin(), lhs.end(),
+                                        rhs.begin(), rhs.end());
+}
+
+template< class Key, class T, class Alloc >
+bool operator>( const ft::int_map<Key, T, Alloc>& lhs,
+                const ft::int_map<Key, T, Alloc>& rhs ){
+    return rhs < lhs;
+}
+
+template< class Key, class T, class Alloc >
+bool operator<=( const ft::int_map<Key, T, Alloc>& lhs,
+                 const ft::int_map<Key, T, Alloc>& rhs ){
+    return !(rhs < lhs);
+}
+
+template< class Key, class T, class Alloc >
+bool operator>=( const ft::int_map<Key, T, Alloc>& lhs,
+                 const ft::int_map<Key, T, Alloc>& rhs ){
+    return !(lhs < rhs);
+}
+
+template< class Key, class T, class Alloc >
+void swap( ft::int_map<Key, T, Alloc>& lhs, ft::int_map<Key, T, Alloc>& rhs ){
+    lhs.swap(rhs);
+}
+
+} // --------- End of ft namespace
+
+#endif
@@ -0,0 +1,289 @@
+#ifndef INTERVAL_MAP_HPP
+# define INTERVAL_MAP_HPP
+
+# include "../utils/rb_tree.hpp"  // the tree, see there for everything shared with map
+# include "../utils/pair.hpp"     // needed for ft::pair and ft::make_pair
+
+# include <memory>      // needed for std::allocator
+# include <functional>  // needed for std::less
+
+namespace ft {
+
+/*
+ * Multimap of half-open intervals [first, second) of Bound, that finds
+ * the intervals overlapping a range or containing a point.
+ *
+ * Intervals are ordered by their start then their end, the same
+ * interval can be there several times (kept in insertion order, as in
+ * multimap). Each node also keeps the highest end of its subtree
+ * (see interval_max_end): a query skips every subtree ending before
+ * it and every right subtree starting after it. Reporting k intervals
+ * costs O(log n + k) on usual data, O(min(n, k log n)) at worst.
+ *
+ * Compare orders the bounds. The highest ends are updated by static
+ * functions of the tree, with a default constructed Compare: it can't
+ * have a state, so the constructors don't take one.
+*/
+
+// Orders the intervals by start, then by end
+template <class Bound, class Compare>
+struct interval_less {
+    typedef ft::pair<Bound, Bound>  interval_type;
+    typedef bool                    result_type;
+    typedef interval_type           first_argument_type;
+    typedef interval_type           second_argument_type;
+
+    Compare comp;
+
+    interval_less(const Compare& c = Compare()): comp(c) {}
+
+    bool operator()(const interval_type& x, const interval_type& y) const {
+        if (comp(x.first, y.first))
+            return true;
+        if (comp(y.first, x.first))
+            return false;
+        return comp(x.second, y.second);
+    }
+};
+
+// Node augmentation (see rb_no_augment): the highest end of the
+// subtree, pointed in its value (values never move), NULL when the
+// subtree has no interval
+template <class Bound, class Compare>
+struct interval_max_end {
+    static const bool enabled = true;
+
+    const Bound *max_end;
+
+    interval_max_end(): max_end(NULL) {}
+
+    template <class Node>
+    static void update(Node *n) {
+        const Bound *m = n->val ? &n->val->first.second : NULL;
+        if (n->l)
+            m = _higher(m, n->l->max_end);
+        if (n->r)
+            m = _higher(m, n->r->max_end);
+        n->max_end = m;
+    }
+
+    static const Bound *_higher(const Bound *a, const Bound *b) {
+        if (!a)
+            return b;
+        if (!b)
+            return a;
+        return Compare()(*a, *b) ? b : a;
+    }
+};
+
+template <
+    class Bound,
+    class T,
+    class Compare = std::less<Bound>,
+    class Alloc = std::allocator<ft::pair<const ft::pair<Bound, Bound>, T> >
+> class interval_map : public rb_tree<ft::pair<Bound, Bound>,
+                                      ft::pair<const ft::pair<Bound, Bound>, T>,
+                                      select_first<ft::pair<const ft::pair<Bound, Bound>, T> >,
+                                      interval_less<Bound, Compare>, Alloc,
+                                      interval_max_end<Bound, Compare>, false> {
+    typedef rb_tree<ft::pair<Bound, Bound>,
+                    ft::pair<const ft::pair<Bound, Bound>, T>,
+                    select_first<ft::pair<const ft::pair<Bound, Bound>, T> >,
+                    interval_less<Bound, Compare>, Alloc,
+                    interval_max_end<Bound, Compare>, false>  tree_type;
+    typedef typename tree_type::node_type                     node_type;
+
+    public:
+
+    /*
+     * **************************************
+     * ********** Member Types **************
+     * **************************************
+    */
+
+    typedef Bound                       bound_type;
+    typedef ft::pair<Bound, Bound>      key_type;
+    typedef T                           mapped_type;
+    typedef ft::pair<const key_type, T> value_type;
+
+    typedef std::ptrdiff_t          difference_type;
+    typedef std::size_t             size_type;
+    typedef Alloc                   allocator_type;
+    typedef value_type&             reference;
+    typedef const value_type&       const_reference;
+
+    typedef typename Alloc::pointer       pointer;
+    typedef typename Alloc::const_pointer const_pointer;
+
+    typedef Compare                         bound_compare;
+    typedef interval_less<Bound, Compare>   key_compare;
+
+    //Class that compares 2 objects of value_type
+    class value_compare :
+    public std::binary_function<value_type, value_type, bool> {
+        friend class interval_map;
+        protected:
+        key_compare comp;
+        // constructed with interval_map's comparison object
+        value_compare (key_compare c) : comp(c) {}
+        public:
+        typedef bool result_type;
+        typedef value_type first_argument_type;
+        typedef value_type second_argument_type;
+        bool operator() (const value_type& x, const value_type& y) const {
+            return comp(x.first, y.first);
+        }
+    };
+
+    typedef typename tree_type::iterator                iterator;
+    typedef typename tree_type::const_iterator          const_iterator;
+    typedef typename tree_type::reverse_iterator        reverse_iterator;
+    typedef typename tree_type::const_reverse_iterator  const_reverse_iterator;
+
+    typedef typename tree_type::node_handle_type        node_handle_type;
+
+    /*
+     * **************************************
+     * ********* Member Functions ***********
+     * **************************************
+    */
+
+    // ***** Constructors *****
+    //
+    // No comparison object, see above
+    //
+    // Default
+    explicit interval_map (const allocator_type& alloc = allocator_type()) :
+        tree_type(key_compare(), alloc) {}
+
+    // Range
+    template< class InputIt >
+    interval_map (InputIt first, InputIt last,
+                  const allocator_type& alloc = allocator_type()) :
+        tree_type(key_compare(), alloc)
+    { this->insert(first, last); }
+
+    // Copy
+    interval_map (const interval_map & cpy): tree_type(cpy) {}
+
+
+    // ***** Destructor *****
+    ~interval_map() {}
+
+
+    // ***** Assignment operator *****
+    interval_map& operator=(const interval_map& other){
+        tree_type::operator=(other);
+        return *this;
+    }
+
+    /*
+     * **************************************
+     * ************ Modifiers ***************
+     * **************************************
+    */
+
+    // ***** Insert *****
+    // Always inserts, after the same intervals. The end of the interval
+    // can't be before its start
+    iterator insert(const value_type & x){
+        return tree_type::insert(x).first;
+    }
+
+    // Insert hint
+    iterator insert(iterator pos, const value_type & x){
+        (void)pos;
+        return insert(x);
+    }
+
+    // Insert range
+    template< class InputIt >
+    void insert( InputIt first, InputIt last ){
+        tree_type::insert(first, last);
+    }
+
+    // ***** insert node *****
+    iterator insert(const node_handle_type & nh){
+        return tree_type::insert(nh).position;
+    }
+
+    iterator insert(const_iterator pos, const node_handle_type & nh){
+        return tree_type::insert(pos, nh);
+    }
+
+    /*
+     * **************************************
+     * ************* Queries ****************
+     * **************************************
+    */
+
+    // ***** overlap *****
+    // Writes to out the intervals that share a point with [lo, hi),
+    // in order, as iterators
+    template< class OutputIt >
+    OutputIt overlap(const bound_type& lo, const bound_type& hi, OutputIt out){
+        return _overlap<iterator>(this->_root, lo, hi, false, out);
+    }
+
+    template< class OutputIt >
+    OutputIt overlap(const bound_type& lo, const bound_type& hi, OutputIt out) const {
+        return _overlap<const_iterator>(this->_root, lo, hi, false, out);
+    }
+
+    // ***** stab *****
+    // Writes to out the intervals that contain x, in order, as iterators
+    template< class OutputIt >
+    OutputIt stab(const bound_type& x, OutputIt out){
+        return _overlap<iterator>(this->_root, x, x, true, out);
+    }
+
+    template< class OutputIt >
+    OutputIt stab(const bound_type& x, OutputIt out) const {
+        return _overlap<const_iterator>(this->_root, x, x, true, out);
+    }
+
+    /*
+     * **************************************
+     * ************ Observers ***************
+     * **************************************
+    */
+
+    bound_compare bound_comp() const { return this->key_comp().comp; }
+
+    value_compare value_comp() const { return value_compare(this->key_comp()); }
+
+private:
+    // In order walk of the intervals ending after lo and starting
+    // before hi (or at hi when closed, for stab)
+    template< class Iter, class OutputIt >
+    OutputIt _overlap(node_type *n, const bound_type& lo, const bound_type& hi,
+                      bool closed, OutputIt out) const {
+        Compare comp = bound_comp();
+
+        while (n && n->max_end && comp(lo, *n->max_end)){
+            out = _overlap<Iter>(n->l, lo, hi, closed, out);
+            if (n->val){
+                const key_type &k = n->val->first;
+                if (closed ? comp(hi, k.first) : !comp(k.first, hi))
+                    break;  // so does everything on its right
+                if (comp(lo, k.second))
+                    *out++ = Iter(n);
+            }
+            n = n->r;
+        }
+        return out;
+    }
+
+    // need unique keys, see rb_tree
+    using tree_type::split;
+    using tree_type::join;
+    using tree_type::parallel_union;
+    using tree_type::parallel_intersection;
+    using tree_type::parallel_difference;
+    using tree_type::insert_batch;
+
+};  // --------- End of interval_map
+
+} // --------- End of ft namespace
+
+#endif
@@ -0,0 +1,662 @@
+#ifndef PERSISTENT_MAP_HPP
+# define PERSISTENT_MAP_HPP
+
+# include "../utils/comparisons.hpp" // needed relational operators
+# include "../utils/pair.hpp"       // needed for ft::pair and ft::make_pair
+# include "../utils/iterators.hpp" // needed for reverse iterator
+# include "../utils/atomic.hpp"   // reference counts
+
+# include <memory>      // needed for std::allocator
+# include <functional>  // needed for std::less
+# include <limits>      // needed for max_size()
+
+namespace ft {
+
+/*
+ * Ordered map where copies share their nodes (persistent AVL tree)
+ *
+ * Nodes are never modified once built: insert and erase copy the
+ * O(log n) nodes on the path from the root to the change, and point
+ * to the untouched subtrees of the previous version. Each node counts
+ * the parents (or maps) pointing to it and is freed with the last one.
+ *
+ * Copying the map (or snapshot()) is O(1) and the copy keeps its
+ * content whatever happens to the original. Reference counts are
+ * atomic, so snapshots can be handed to other threads: a single
+ * persistent_map object isn't thread safe, but two maps sharing nodes
+ * can be used from different threads.
+ *
+ * Elements can't be modified in place, as they may belong to other
+ * versions: iterators are const, use insert_or_assign() to change a
+ * value. Iterators are invalidated by any change to their map.
+*/
+template <
+    class Key,
+    class T,
+    class Compare = std::less<Key>,
+    class Alloc = std::allocator<ft::pair<const Key, T> >
+> class persistent_map {
+    public:
+
+    /*
+     * **************************************
+     * ********** Member Types **************
+     * **************************************
+    */
+
+    typedef Key                     key_type;
+    typedef T                       mapped_type;
+    typedef ft::pair<const Key, T>  value_type;
+
+    typedef std::ptrdiff_t          difference_type;
+    typedef std::size_t             size_type;
+    typedef Alloc                   allocator_type;
+    typedef const value_type&       reference;
+    typedef const value_type&       const_reference;
+
+    typedef typename Alloc::const_pointer pointer;
+    typedef typename Alloc::const_pointer const_pointer;
+
+    typedef Compare                 key_compare;
+
+    //Class that compares 2 objects of value_type
+    class value_compare :
+    public std::binary_function<value_type, value_type, bool> {
+        friend class persistent_map;
+        protected:
+        Compare comp;
+        // constructed with map's comparison object
+        value_compare (Compare c) : comp(c) {}
+        public:
+        typedef bool result_type;
+        typedef value_type first_argument_type;
+        typedef value_type second_argument_type;
+        bool operator() (const value_type& x, const value_type& y) const {
+            return comp(x.first, y.first);
+        }
+    };
+
+private:
+    // ***** private AVL node_type *****
+    // built once, then shared by every version pointing to it
+    struct node_type {
+        volatile size_type  refs;   // parents and maps pointing here
+        int                 height; // 1 for a leaf
+        node_type *         l;
+        node_type *         r;
+        value_type          val;
+    };
+
+    typedef typename Alloc::template rebind<node_type>::other   node_allocator_type;
+
+public:
+
+    /*
+     * **************************************
+     * ************ Iterator ****************
+     * **************************************
+    */
+
+    // Bidirectional iterator, nodes have no parent (they're shared)
+    // so moving searches the next key from the root: O(log n) per step
+    class const_iterator {
+        friend class persistent_map;
+
+        const node_type *   _root;
+        const node_type *   _ptr;   // NULL for end()
+        key_compare         _cmp_k;
+
+        const_iterator(const node_type *root, const node_type *p, const key_compare &cmp):
+            _root(root), _ptr(p), _cmp_k(cmp) {}
+
+        public:
+        typedef const ft::pair<const Key, T>     value_type;
+        typedef std::ptrdiff_t                   difference_type;
+        typedef value_type*                      pointer;
+        typedef value_type&                      reference;
+        typedef std::bidirectional_iterator_tag  iterator_category;
+
+        const_iterator(): _root(NULL), _ptr(NULL), _cmp_k() {}
+        const_iterator(const const_iterator &it):
+            _root(it._root), _ptr(it._ptr), _cmp_k(it._cmp_k) {}
+
+        const_iterator& operator=(const const_iterator &it) {
+            _root = it._root;
+            _ptr = it._ptr;
+            _cmp_k = it._cmp_k;
+            return *this;
+        }
+
+        reference operator * () const { return _ptr->val; }
+        pointer   operator -> () const { return &_ptr->val; }
+
+        // smallest key greater than the current one
+        const_iterator& operator++() {
+            const node_type *next = NULL;
+            const node_type *cur = _root;
+            while (cur) {
+                if (_cmp_k(_ptr->val.first, cur->val.first)) {
+                    next = cur;
+                    cur = cur->l;
+                }
+                else
+                    cur = cur->r;
+            }
+            _ptr = next;
+            return *this;
+        }
+        const_iterator operator++(int) { const_iterator copy(*this); ++*this; return copy; }
+
+        // greatest key lower than the current one, last one from end()
+        const_iterator& operator--() {
+            const node_type *prev = NULL;
+            const node_type *cur = _root;
+            while (cur) {
+                if (!_ptr || _cmp_k(cur->val.first, _ptr->val.first)) {
+                    prev = cur;
+                    cur = cur->r;
+                }
+                else
+                    cur = cur->l;
+            }
+            _ptr = prev;
+            return *this;
+        }
+        const_iterator operator--(int) { const_iterator copy(*this); --*this; return copy; }
+
+        bool operator==(const const_iterator &it) const { return _ptr == it._ptr; }
+        bool operator!=(const const_iterator &it) const { return _ptr != it._ptr; }
+    };
+
+    typedef const_iterator                       iterator;
+    typedef ft::reverse_iterator<const_iterator> const_reverse_iterator;
+    typedef const_reverse_iterator               reverse_iterator;
+
+    friend class const_iterator;
+
+    /*
+     * **************************************
+     * ************ Variables ***************
+     * **************************************
+    */
+
+private:
+    node_type *             _root;
+    key_compare             _cmp_k;
+    allocator_type          _al;
+    node_allocator_type     _nal;
+    size_type               _sz;
+
+    /*
+     * **************************************
+     * ********* Private Functions **********
+     * **************************************
+    */
+
+    static int _height(const node_type *n) { return n ? n->height : 0; }
+
+    static node_type *_retain(node_type *n) {
+        if (n)
+            atomic_fetch_add(&n->refs, static_cast<size_type>(1), mo_relaxed);
+        return n;
+    }
+
+    // Drops a reference, frees the node and releases its children
+    // if it was the last one
+    void _release(node_type *n) {
+        while (n && atomic_fetch_sub(&n->refs, static_cast<size_type>(1), mo_acq_rel) == 1) {
+            node_type *r = n->r;
+            _release(n->l);
+            _al.destroy(&n->val);
+            _nal.deallocate(n, 1);
+            n = r;
+        }
+    }
+
+    // Unlinked node, refs set to 1
+    node_type *_node(const value_type &x) {
+        node_type *n = _nal.allocate(1);
+        try { _al.construct(&n->val, x); }
+        catch (...) { _nal.deallocate(n, 1); throw; }
+        n->refs = 1;
+        n->l = NULL;
+        n->r = NULL;
+        n->height = 1;
+        return n;
+    }
+
+    // Takes the references to l and r
+    static node_type *_link(node_type *n, node_type *l, node_type *r) {
+        n->l = l;
+        n->r = r;
+        n->height = 1 + (_height(l) > _height(r) ? _height(l) : _height(r));
+        return n;
+    }
+
+    // New node owning the references to l and r
+    // (released if the node can't be built)
+    node_type *_make(const value_type &x, node_type *l, node_type *r) {
+        node_type *n;
+        try { n = _node(x); }
+        catch (...) { _release(l); _release(r); throw; }
+        return _link(n, l, r);
+    }
+
+    // Builds the nodes of a rotation before linking anything,
+    // on failure l and r are released like in _make
+    void _nodes(node_type **out, const value_type **vals, int count,
+                node_type *l, node_type *r) {
+        int i = 0;
+        try {
+            for (; i < count; ++i)
+                out[i] = _node(*vals[i]);
+        }
+        catch (...) {
+            while (i--)
+                _release(out[i]);
+            _release(l);
+            _release(r);
+            throw;
+        }
+    }
+
+    // Copy of a node with new children, rotated if their heights
+    // differ by 2. Takes the references to l and r.
+    node_type *_balance(const value_type &x, node_type *l, node_type *r) {
+        node_type       *n[3];
+        const value_type *vals[3];
+
+        if (_height(l) > _height(r) + 1) {
+            if (_height(l->l) >= _height(l->r)) {
+                // single right rotation
+                vals[0] = &l->val;
+                vals[1] = &x;
+                _nodes(n, vals, 2, l, r);
+                _link(n[0], _retain(l->l), _link(n[1], _retain(l->r), r));
+            }
+            else {
+                // left-right rotation
+                node_type *lr = l->r;
+                vals[0] = &lr->val;
+                vals[1] = &l->val;
+                vals[2] = &x;
+                _nodes(n, vals, 3, l, r);
+                _link(n[0], _link(n[1], _retain(l->l), _retain(lr->l)),
+                            _link(n[2], _retain(lr->r), r));
+            }
+            _release(l);
+            return n[0];
+        }
+        if (_height(r) > _height(l) + 1) {
+            if (_height(r->r) >= _height(r->l)) {
+                // single left rotation
+                vals[0] = &r->val;
+                vals[1] = &x;
+                _nodes(n, vals, 2, l, r);
+                _link(n[0], _link(n[1], l, _retain(r->l)), _retain(r->r));
+            }
+            else {
+                // right-left rotation
+                node_type *rl = r->l;
+                vals[0] = &rl->val;
+                vals[1] = &x;
+                vals[2] = &r->val;
+                _nodes(n, vals, 3, l, r);
+                _link(n[0], _link(n[1], l, _retain(rl->l)),
+                            _link(n[2], _retain(rl->r), _retain(r->r)));
+            }
+            _release(r);
+            return n[0];
+        }
+        return _make(x, l, r);
+    }
+
+    // New version of the subtree with x added, the key must not be there
+    node_type *_insert(node_type *n, const value_type &x) {
+        if (!n)
+            return _make(x, NULL, NULL);
+        if (_cmp_k(x.first, n->val.first)) {
+            node_type *l = _insert(n->l, x);
+            return _balance(n->val, l, _retain(n->r));
+        }
+        node_type *r = _insert(n->r, x);
+        return _balance(n->val, _retain(n->l), r);
+    }
+
+    // New version of the subtree with the value of x.first replaced,
+    // the key must be there. Same shape, no balancing needed
+    node_type *_assign(node_type *n, const value_type &x) {
+        if (_cmp_k(x.first, n->val.first)) {
+            node_type *l = _assign(n->l, x);
+            return _make(n->val, l, _retain(n->r));
+        }
+        if (_cmp_k(n->val.first, x.first)) {
+            node_type *r = _assign(n->r, x);
+            return _make(n->val, _retain(n->l), r);
+        }
+        return _make(x, _retain(n->l), _retain(n->r));
+    }
+
+    // New version of the subtree without its smallest node
+    node_type *_erase_min(node_type *n) {
+        if (!n->l)
+            return _retain(n->r);
+        node_type *l = _erase_min(n->l);
+        return _balance(n->val, l, _retain(n->r));
+    }
+
+    // New version of the subtree without k, the key must be there
+    node_type *_erase(node_type *n, const key_type &k) {
+        if (_cmp_k(k, n->val.first)) {
+            node_type *l = _erase(n->l, k);
+            return _balance(n->val, l, _retain(n->r));
+        }
+        if (_cmp_k(n->val.first, k)) {
+            node_type *r = _erase(n->r, k);
+            return _balance(n->val, _retain(n->l), r);
+        }
+        if (!n->l)
+            return _retain(n->r);
+        if (!n->r)
+            return _retain(n->l);
+        // replaced by its successor, still alive in the old version
+        node_type *succ = n->r;
+        while (succ->l)
+            succ = succ->l;
+        node_type *r = _erase_min(n->r);
+        return _balance(succ->val, _retain(n->l), r);
+    }
+
+    // Swaps in a new root, the old version is released
+    void _set_root(node_type *root, size_type sz) {
+        node_type *old = _root;
+        _root = root;
+        _sz = sz;
+        _release(old);
+    }
+
+    node_type *_find(const key_type &k) const {
+        node_type *n = _root;
+        while (n) {
+            if (_cmp_k(k, n->val.first))
+                n = n->l;
+            else if (_cmp_k(n->val.first, k))
+                n = n->r;
+            else
+                return n;
+        }
+        return NULL;
+    }
+
+    const_iterator _it(const node_type *n) const { return const_iterator(_root, n, _cmp_k); }
+
+public:
+
+    /*
+     * **************************************
+     * ********* Member Functions ***********
+     * **************************************
+    */
+
+    // ***** Constructors *****
+    //
+    // Default
+    explicit persistent_map(const key_compare& comp = key_compare(),
+                            const allocator_type& alloc = allocator_type()):
+        _root(NULL), _cmp_k(comp), _al(alloc), _nal(alloc), _sz(0) {}
+
+    // Range
+    template< class InputIt >
+    persistent_map(InputIt first, InputIt last,
+                   const key_compare& comp = key_compare(),
+                   const allocator_type& alloc = allocator_type()):
+        _root(NULL), _cmp_k(comp), _al(alloc), _nal(alloc), _sz(0)
+    { insert(first, last); }
+
+    // Copy, O(1): both maps share every node
+    persistent_map(const persistent_map& other):
+        _root(_retain(other._root)), _cmp_k(other._cmp_k),
+        _al(other._al), _nal(other._nal), _sz(other._sz) {}
+
+    // ***** Destructor *****
+    ~persistent_map() { _release(_root); }
+
+    // ***** Assignment operator *****
+    // O(1) too, the previous content is released
+    persistent_map& operator=(const persistent_map& other) {
+        _retain(other._root);
+        _cmp_k = other._cmp_k;
+        _set_root(other._root, other._sz);
+        return *this;
+    }
+
+    // Version of the map that later changes won't affect
+    persistent_map snapshot() const { return *this; }
+
+    allocator_type get_allocator() const { return _al; }
+
+    /*
+     * **************************************
+     * ************* Iterator ***************
+     * **************************************
+    */
+
+    const_iterator begin() const {
+        const node_type *n = _root;
+        while (n && n->l)
+            n = n->l;
+        return _it(n);
+    }
+
+    const_iterator end() const { return _it(NULL); }
+
+    const_reverse_iterator rbegin() const { return const_reverse_iterator(end()); }
+
+    const_reverse_iterator rend() const { return const_reverse_iterator(begin()); }
+
+    /*
+     * **************************************
+     * ************* Capacity ***************
+     * **************************************
+    */
+
+    bool empty() const { return !_sz; }
+
+    size_type size() const { return _sz; }
+
+    size_type max_size() const {
+        return std::numeric_limits<difference_type>::max() / sizeof(node_type);
+    }
+
+    /*
+     * **************************************
+     * ********** Element Access ************
+     * **************************************
+    */
+
+    const mapped_type& at(const key_type& k) const {
+        const node_type *n = _find(k);
+        if (!n)
+            throw std::out_of_range("ft::persistent_map::at");
+        return n->val.second;
+    }
+
+    /*
+     * **************************************
+     * ************ Modifiers ***************
+     * **************************************
+    */
+
+    // ***** Insert *****
+    // Copies the path to the new node, O(log n) allocations
+    ft::pair<const_iterator, bool> insert(const value_type& x) {
+        node_type *n = _find(x.first);
+        if (n)
+            return ft::make_pair(_it(n), false);
+        _set_root(_insert(_root, x), _sz + 1);
+        return ft::make_pair(find(x.first), true);
+    }
+
+    // Insert with hint, the hint is useless without parents
+    const_iterator insert(const_iterator hint, const value_type& x) {
+        (void)hint;
+        return insert(x).first;
+    }
+
+    // Insert range
+    template< class InputIt >
+    void insert( InputIt first, InputIt last ){
+        for (; first != last; ++first)
+            insert(*first);
+    }
+
+    // ***** insert_or_assign *****
+    // Elements are shared so they can't be changed in place,
+    // replaces the value of k or inserts it
+    ft::pair<const_iterator, bool> insert_or_assign(const key_type& k, const mapped_type& obj) {
+        value_type x(k, obj);
+        if (!_find(k))
+            return insert(x);
+        _set_root(_assign(_root, x), _sz);
+        return ft::make_pair(find(k), false);
+    }
+
+    // ***** erase *****
+    size_type erase(const key_type& k) {
+        if (!_find(k))
+            return 0;
+        _set_root(_erase(_root, k), _sz - 1);
+        return 1;
+    }
+
+    void erase(const_iterator pos) { erase(pos->first); }
+
+    // every step makes a new version, so the iterators are
+    // replaced by lookups of their keys
+    void erase(const_iterator first, const_iterator last) {
+        if (first == last)
+            return;
+        bool     to_end = last == end();
+        key_type stop = to_end ? first->first : last->first;
+        while (first != end() && (to_end || _cmp_k(first->first, stop))) {
+            key_type k = first->first;
+            erase(k);
+            first = lower_bound(k);
+        }
+    }
+
+    // ***** clear *****
+    // Nodes still used by other versions stay alive
+    void clear() { _set_root(NULL, 0); }
+
+    // ***** swap *****
+    void swap(persistent_map& other) {
+        node_type *     tmp_root = other._root;
+        key_compare     tmp_cmp = other._cmp_k;
+        size_type       tmp_sz = other._sz;
+
+        other._root = _root;
+        other._cmp_k = _cmp_k;
+        other._sz = _sz;
+
+        _root = tmp_root;
+        _cmp_k = tmp_cmp;
+        _sz = tmp_sz;
+    }
+
+    /*
+     * **************************************
+     * ************** Lookup ****************
+     * **************************************
+    */
+
+    size_type count(const key_type& k) const { return _find(k) != NULL; }
+
+    const_iterator find(const key_type& k) const { return _it(_find(k)); }
+
+    // ***** lower_bound *****
+    // first element not less than k
+    const_iterator lower_bound(const key_type& k) const {
+        const node_type *ret = NULL;
+        const node_type *n = _root;
+        while (n) {
+            if (!_cmp_k(n->val.first, k)) {
+                ret = n;
+                n = n->l;
+            }
+            else
+                n = n->r;
+        }
+        return _it(ret);
+    }
+
+    // ***** upper_bound *****
+    // first element greater than k
+    const_iterator upper_bound(const key_type& k) const {
+        const node_type *ret = NULL;
+        const node_type *n = _root;
+        while (n) {
+            if (_cmp_k(k, n->val.first)) {
+                ret = n;
+                n = n->l;
+            }
+            else
+                n = n->r;
+        }
+        return _it(ret);
+    }
+
+    ft::pair<const_iterator, const_iterator> equal_range(const key_type& k) const {
+        return ft::make_pair(lower_bound(k), upper_bound(k));
+    }
+
+    /*
+     * **************************************
+     * ************ Observers ***************
+     * **************************************
+    */
+
+    key_compare   key_comp()   const { return _cmp_k; }
+    value_compare value_comp() const { return value_compare(_cmp_k); }
+
+    /*
+     * **************************************
+     * ********** Relational Ope ************
+     * **************************************
+    */
+
+    // Versions sharing their root are equal without looking further
+    friend bool operator==( const persistent_map& lhs, const persistent_map& rhs ){
+        if (lhs._sz != rhs._sz)
+            return false;
+        if (lhs._root == rhs._root)
+            return true;
+        return ft::equal(lhs.begin(), lhs.end(), rhs.begin());
+    }
+
+    friend bool operator!=( const persistent_map& lhs, const persistent_map& rhs ){
+        return !(lhs == rhs);
+    }
+
+    friend bool operator<( const persistent_map& lhs, const persistent_map& rhs ){
+        return ft::lexicographical_compare(lhs.begin(), lhs.end(),
+                                           rhs.begin(), rhs.end());
+    }
+
+    friend bool operator>( const persistent_map& lhs, const persistent_map& rhs ){
+        return rhs < lhs;
+    }
+
+    friend bool operator<=( const persistent_map& lhs, const persistent_map& rhs ){
+        return !(rhs < lhs);
+    }
+
+    friend bool operator>=( const persistent_map& lhs, const persistent_map& rhs ){
+        return !(lhs < rhs);
+    }
+
+};  // --------- End of persistent_map
+
+} // --------- End of ft namespace
+
+#endif
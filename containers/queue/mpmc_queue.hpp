@@ -0,0 +1,201 @@
+#ifndef MPMC_QUEUE_HPP
+# define MPMC_QUEUE_HPP
+
+# include <memory> // needed for std::allocator
+# include <cstddef> // needed for ptrdiff_t
+
+// atomic builtins wrappers
+# include "../utils/atomic.hpp"
+
+namespace ft {
+
+/*
+ * Bounded lock-free FIFO queue, for many producers and many consumers.
+ *
+ * Each slot of the circular buffer carries a sequence number telling
+ * whether it is ready to be written (seq == position) or read
+ * (seq == position + 1): a producer (or consumer) claims a position by
+ * a compare and swap on the tail (or head) index, then publishes
+ * the slot by bumping its sequence number.
+ * Head and tail are on separate cache lines, so producers and
+ * consumers don't invalidate each other.
+ * Capacity is fixed at construction, rounded up to a power of 2.
+ * Once a slot is claimed it has to be published, so copying
+ * value_type must not throw.
+*/
+template<
+    class T,
+    class Alloc = std::allocator<T>
+> class mpmc_queue {
+
+public:
+
+    /*
+     * **************************************
+     * ********** Member Types **************
+     * **************************************
+    */
+
+    typedef T                                       value_type;
+    typedef Alloc                                   allocator_type;
+    typedef typename allocator_type::pointer         pointer;
+    typedef typename allocator_type::size_type       size_type;
+
+private:
+
+    typedef typename Alloc::template rebind<size_type>::other   seq_allocator_type;
+
+    /*
+     * **************************************
+     * ************ Variables ***************
+     * **************************************
+    */
+
+    char                    _pad0[FT_CACHELINE];
+    volatile size_type      _tail;      // next position to push
+    char                    _pad1[FT_CACHELINE - sizeof(size_type)];
+    volatile size_type      _head;      // next position to pop
+    char                    _pad2[FT_CACHELINE - sizeof(size_type)];
+    size_type               _mask;      // capacity - 1
+    volatile size_type *    _seq;       // sequence number of each slot
+    pointer                 _ar;        // slots
+    allocator_type          _al;
+    seq_allocator_type      _seq_al;
+
+    // Not copyable, a copy couldn't be made atomically
+    mpmc_queue(const mpmc_queue &);
+    mpmc_queue& operator=(const mpmc_queue &);
+
+    static size_type _round_capacity(size_type n) {
+        size_type cp = 2;
+        while (cp < n)
+            cp *= 2;
+        return cp;
+    }
+
+    // Signed distance between two positions, they wrap around
+    static std::ptrdiff_t _dist(size_type a, size_type b) {
+        return static_cast<std::ptrdiff_t>(a - b);
+    }
+
+public:
+
+    /*
+     * **************************************
+     * ********* Member Functions ***********
+     * **************************************
+    */
+
+    // ***** Constructors *****
+
+    explicit mpmc_queue(size_type capacity,
+                        const allocator_type& alloc = allocator_type()):
+        _tail(0), _head(0),
+        _mask(_round_capacity(capacity) - 1),
+        _seq(NULL), _ar(NULL),
+        _al(alloc), _seq_al(alloc)
+    {
+        size_type *seq = _seq_al.allocate(_mask + 1);
+        for (size_type i = 0; i <= _mask; i++)
+            seq[i] = i;
+        _seq = seq;
+        try { _ar = _al.allocate(_mask + 1); }
+        catch (...) { _seq_al.deallocate(seq, _mask + 1); throw; }
+    }
+
+    // ***** Destructor *****
+    // No other thread may use the queue anymore
+    ~mpmc_queue() {
+        for (size_type pos = _head; pos != _tail; ++pos)
+            _al.destroy(_ar + (pos & _mask));
+        _al.deallocate(_ar, _mask + 1);
+        _seq_al.deallocate(const_cast<size_type *>(_seq), _mask + 1);
+    }
+
+    /*
+     * **************************************
+     * ************* Capacity ***************
+     * **************************************
+    */
+
+    size_type capacity() const { return _mask + 1; }
+
+    // Only a snapshot, other threads may push or pop right after
+    size_type size() const {
+        size_type head = atomic_load(&_head, mo_relaxed);
+        size_type tail = atomic_load(&_tail, mo_relaxed);
+        return _dist(tail, head) > 0 ? tail - head : 0;
+    }
+
+    bool empty() const { return !size(); }
+
+    /*
+     * **************************************
+     * ************ Modifiers ***************
+     * **************************************
+    */
+
+    // ***** try_push *****
+    // Returns false if the queue is full
+    bool try_push(const value_type& value) {
+        size_type pos = atomic_load(&_tail, mo_relaxed);
+        while (true) {
+            size_type      seq = atomic_load(_seq + (pos & _mask));
+            std::ptrdiff_t dif = _dist(seq, pos);
+            if (dif == 0) {
+                if (atomic_cas(&_tail, pos, pos + 1, mo_relaxed))
+                    break;
+            }
+            else if (dif < 0)
+                return false;
+            else
+                pos = atomic_load(&_tail, mo_relaxed);
+        }
+        _al.construct(_ar + (pos & _mask), value);
+        atomic_store(_seq + (pos & _mask), pos + 1);
+        return true;
+    }
+
+    // ***** try_pop *****
+    // Copies the front element in out and removes it,
+    // returns false if the queue is empty
+    bool try_pop(value_type& out) {
+        size_type pos = atomic_load(&_head, mo_relaxed);
+        while (true) {
+            size_type      seq = atomic_load(_seq + (pos & _mask));
+            std::ptrdiff_t dif = _dist(seq, pos + 1);
+            if (dif == 0) {
+                if (atomic_cas(&_head, pos, pos + 1, mo_relaxed))
+                    break;
+            }
+            else if (dif < 0)
+                return false;
+            else
+                pos = atomic_load(&_head, mo_relaxed);
+        }
+        out = _ar[pos & _mask];
+        _al.destroy(_ar + (pos & _mask));
+        atomic_store(_seq + (pos & _mask), pos + _mask + 1);
+        return true;
+    }
+
+    // ***** push *****
+    // Spins until there is room
+    void push(const value_type& value) {
+        backoff wait;
+        while (!try_push(value))
+            wait();
+    }
+
+    // ***** pop *****
+    // Spins until an element is available
+    void pop(value_type& out) {
+        backoff wait;
+        while (!try_pop(out))
+            wait();
+    }
+};
+// End of mpmc_queue scope
+
+}
+#endif
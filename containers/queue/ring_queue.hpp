@@ -0,0 +1,211 @@
+#ifndef RING_QUEUE_HPP
+# define RING_QUEUE_HPP
+
+# include <memory> // needed for std::allocator
+
+namespace ft {
+
+/*
+ * FIFO queue stored in a single circular buffer.
+ *
+ * Same interface as std::queue, but without an underlying container:
+ * pushing and popping only move the head and tail indexes,
+ * the buffer (capacity is a power of 2) doubles when full.
+ * Not thread safe, see ft::mpmc_queue for a shared queue.
+*/
+template<
+    class T,
+    class Alloc = std::allocator<T>
+> class ring_queue {
+
+public:
+
+    /*
+     * **************************************
+     * ********** Member Types **************
+     * **************************************
+    */
+
+    typedef T                                       value_type;
+    typedef Alloc                                   allocator_type;
+    typedef typename allocator_type::reference       reference;
+    typedef typename allocator_type::const_reference const_reference;
+    typedef typename allocator_type::pointer         pointer;
+    typedef typename allocator_type::size_type       size_type;
+
+private:
+
+    /*
+     * **************************************
+     * ************ Variables ***************
+     * **************************************
+    */
+
+    allocator_type  _al;    // Allocator
+    pointer         _ar;    // Circular buffer
+    size_type       _head;  // Index of front() (not wrapped)
+    size_type       _sz;    // this.size()
+    size_type       _cp;    // Buffer size, 0 or a power of 2
+
+    /*
+     * **************************************
+     * ********* Private Functions **********
+     * **************************************
+    */
+
+    size_type _slot(size_type i) const { return (_head + i) & (_cp - 1); }
+
+    // Moves elements in a new buffer, front() going to index 0
+    void realloc_self(size_type new_cp) {
+        pointer old_ar = _ar;
+
+        _ar = _al.allocate(new_cp);
+        for (size_type i = 0; i < _sz; i++) {
+            _al.construct(_ar + i, old_ar[(_head + i) & (_cp - 1)]);
+            _al.destroy(old_ar + ((_head + i) & (_cp - 1)));
+        }
+        if (_cp)
+            _al.deallocate(old_ar, _cp);
+        _head = 0;
+        _cp = new_cp;
+    }
+
+    // Destroys and deallocate all queue content
+    void empty_self() {
+        clear();
+        if (_cp)
+            _al.deallocate(_ar, _cp);
+        _ar = 0;
+        _cp = 0;
+    }
+
+public:
+
+    /*
+     * **************************************
+     * ********* Member Functions ***********
+     * **************************************
+    */
+
+    // ***** Constructors *****
+
+    explicit ring_queue(const allocator_type& alloc = allocator_type()):
+        _al(alloc), _ar(0), _head(0), _sz(0), _cp(0) {}
+
+    ring_queue(const ring_queue& other):
+        _al(other._al), _ar(0), _head(0), _sz(0), _cp(0)
+    { *this = other; }
+
+    // ***** Destructor *****
+    ~ring_queue() { empty_self(); }
+
+    // ***** Assignment operator *****
+    ring_queue& operator=(const ring_queue& other) {
+        if (this == &other)
+            return *this;
+        clear();
+        reserve(other._sz);
+        for (size_type i = 0; i < other._sz; i++)
+            push(other._ar[other._slot(i)]);
+        return *this;
+    }
+
+    /*
+     * **************************************
+     * ********** Element Access ************
+     * **************************************
+    */
+
+    reference       front()       { return _ar[_head & (_cp - 1)]; }
+    const_reference front() const { return _ar[_head & (_cp - 1)]; }
+
+    reference       back()       { return _ar[_slot(_sz - 1)]; }
+    const_reference back() const { return _ar[_slot(_sz - 1)]; }
+
+    /*
+     * **************************************
+     * ************* Capacity ***************
+     * **************************************
+    */
+
+    bool empty() const { return !_sz; }
+
+    size_type size() const { return _sz; }
+
+    size_type capacity() const { return _cp; }
+
+    // Makes room for n elements (rounded to the next power of 2)
+    void reserve(size_type n) {
+        if (n <= _cp)
+            return;
+        size_type new_cp = _cp ? _cp : 1;
+        while (new_cp < n)
+            new_cp *= 2;
+        realloc_self(new_cp);
+    }
+
+    /*
+     * **************************************
+     * ************ Modifiers ***************
+     * **************************************
+    */
+
+    void push(const value_type& value) {
+        if (_sz == _cp)
+            reserve(_cp ? _cp * 2 : 16);
+        _al.construct(_ar + _slot(_sz), value);
+        ++_sz;
+    }
+
+    void pop() {
+        _al.destroy(_ar + (_head & (_cp - 1)));
+        ++_head;
+        --_sz;
+    }
+
+    void clear() {
+        while (_sz)
+            pop();
+        _head = 0;
+    }
+
+    void swap(ring_queue& other) {
+        pointer   tmp_ar = other._ar;
+        size_type tmp_head = other._head;
+        size_type tmp_sz = other._sz;
+        size_type tmp_cp = other._cp;
+
+        other._ar = _ar;
+        other._head = _head;
+        other._sz = _sz;
+        other._cp = _cp;
+
+        _ar = tmp_ar;
+        _head = tmp_head;
+        _sz = tmp_sz;
+        _cp = tmp_cp;
+    }
+
+    /*
+     * **************************************
+     * ********** Relational Ope ************
+     * **************************************
+    */
+
+    friend bool operator==( const ring_queue& lhs, const ring_queue& rhs ){
+        if (lhs._sz != rhs._sz)
+            return false;
+        for (size_type i = 0; i < lhs._sz; i++)
+            if (!(lhs._ar[lhs._slot(i)] == rhs._ar[rhs._slot(i)]))
+                return false;
+        return true;
+    }
+
+    friend bool operator!=( const ring_queue& lhs, const ring_queue& rhs ){
+        return !(lhs == rhs);
+    }
+};
+// End of ring_queue scope
+
+}
+#endif
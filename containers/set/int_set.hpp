@@ -0,0 +1,1140 @@
+#ifndef INT_SET_HPP
+# define INT_SET_HPP
+
+# include "../vector/vector.hpp"      // the chunks
+# include "../utils/comparisons.hpp"  // needed relational operators
+# include "../utils/pair.hpp"         // needed for ft::pair and ft::make_pair
+# include "../utils/type_traits.hpp"  // needed for is_integral
+# include "../utils/int_key.hpp"      // keys as unsigned numbers
+
+# include <memory>      // needed for std::allocator
+# include <functional>  // needed for std::less
+# include <algorithm>   // needed for lower_bound
+# include <limits>      // needed for max_size()
+# include <cstring>     // needed for memmove
+
+namespace ft {
+
+/*
+ * Compressed set of integers, roaring bitmap style
+ *
+ * Keys are cut in a high part, that picks a chunk, and 16 low bits
+ * stored in the chunk in one of three forms:
+ *     array   sorted low bits, 2 bytes per key, up to 4096 keys
+ *     bitmap  65536 bits, 8KB, past 4096 keys
+ *     runs    sorted [first, last] pairs, 4 bytes per run of
+ *             consecutive keys, made by shrink_to_fit() when smaller
+ * Chunks are sorted by high part in a vector. Clustered keys cost 2
+ * bytes or less each (a set node is 40 bytes and more), and the set
+ * algebra works a chunk at a time: merges of arrays, or one operation
+ * per 64 bit word of bitmaps, 64 keys at once.
+ *
+ * Same interface as set, ordered by std::less<Key>. Iterators hold
+ * their key: any insert or erase invalidates them, and the references
+ * they give last as long as the iterator.
+*/
+template <
+    class Key,
+    class Alloc = std::allocator<Key>
+> class int_set {
+    typedef char key_must_be_integral[ft::is_integral<Key>::value ? 1 : -1];
+
+    public:
+
+    /*
+     * **************************************
+     * ********** Member Types **************
+     * **************************************
+    */
+
+    typedef Key                     key_type;
+    typedef Key                     value_type;
+
+    typedef std::ptrdiff_t          difference_type;
+    typedef std::size_t             size_type;
+    typedef Alloc                   allocator_type;
+    typedef value_type&             reference;
+    typedef const value_type&       const_reference;
+
+    typedef typename Alloc::pointer       pointer;
+    typedef typename Alloc::const_pointer const_pointer;
+
+    typedef std::less<Key>          key_compare;
+    typedef std::less<Key>          value_compare;
+
+private:
+    typedef typename int_key<Key>::bits_type    bits_type;
+    typedef unsigned long long                  word_type;  // 64 keys of a bitmap
+    typedef unsigned short                      low_type;
+
+    enum {
+        low_bits = 16,
+        array_max = 4096,       // past this a bitmap is smaller
+        bitmap_words = 1024,
+        run_max = 2048          // past this a bitmap is smaller
+    };
+    enum kind_type { array_kind, bitmap_kind, run_kind };
+
+    // data is bitmap_words words for a bitmap, or low_type values (4 per
+    // word) for an array or runs, each run being its first and last
+    struct chunk_type {
+        bits_type       high;
+        word_type *     data;
+        unsigned        card;   // keys in the chunk
+        unsigned        len;    // values of an array, runs
+        unsigned        cap;    // words allocated
+        unsigned char   kind;
+    };
+
+    typedef typename Alloc::template rebind<word_type>::other   word_allocator_type;
+    typedef typename Alloc::template rebind<chunk_type>::other  chunk_allocator_type;
+    typedef ft::vector<chunk_type, chunk_allocator_type>        chunk_vector;
+
+public:
+
+    /*
+     * **************************************
+     * ************ Iterators ***************
+     * **************************************
+    */
+
+    // Keys are rebuilt from the chunks, the iterator keeps the current one
+    class const_iterator {
+        friend class int_set;
+
+        const chunk_vector *    _chunks;
+        size_type               _at;    // chunk, _chunks->size() at end()
+        unsigned                _pos;   // place in an array, or run
+        unsigned                _low;
+        key_type                _val;
+
+        const_iterator(const chunk_vector *chunks, size_type at, unsigned pos, unsigned low):
+            _chunks(chunks), _at(at), _pos(pos), _low(low), _val() { _load(); }
+
+        // first key of chunk at, or end()
+        const_iterator(const chunk_vector *chunks, size_type at):
+            _chunks(chunks), _at(at), _pos(0), _low(0), _val() {
+            if (_at < _chunks->size())
+                _seek((*_chunks)[_at], _low, _pos);
+            _load();
+        }
+
+        void _load() {
+            if (_at < _chunks->size())
+                _val = int_key<Key>::from_bits((*_chunks)[_at].high << low_bits | _low);
+        }
+
+        public:
+        typedef Key                             value_type;
+        typedef std::ptrdiff_t                  difference_type;
+        typedef const Key*                      pointer;
+        typedef const Key&                      reference;
+        typedef std::bidirectional_iterator_tag iterator_category;
+
+        const_iterator(): _chunks(NULL), _at(0), _pos(0), _low(0), _val() {}
+
+        reference operator * () const { return _val; }
+        pointer   operator -> () const { return &_val; }
+
+        const_iterator& operator++() {
+            if (!_next((*_chunks)[_at], _pos, _low)){
+                _low = 0;
+                if (++_at < _chunks->size())
+                    _seek((*_chunks)[_at], _low, _pos);
+            }
+            _load();
+            return *this;
+        }
+        const_iterator  operator++(int) { const_iterator copy(*this); ++*this; return copy; }
+
+        const_iterator& operator--() {
+            if (_at == _chunks->size() || !_prev((*_chunks)[_at], _pos, _low))
+                _last((*_chunks)[--_at], _pos, _low);
+            _load();
+            return *this;
+        }
+        const_iterator  operator--(int) { const_iterator copy(*this); --*this; return copy; }
+
+        friend bool operator==(const const_iterator &a, const const_iterator &b) {
+            return a._at == b._at && a._low == b._low;
+        }
+        friend bool operator!=(const const_iterator &a, const const_iterator &b) { return !(a == b); }
+    };
+
+    typedef const_iterator  iterator;
+
+    // ft::reverse_iterator would give a key of a temporary iterator,
+    // this one keeps the iterator it reads
+    class const_reverse_iterator {
+        const_iterator          _base;
+        mutable const_iterator  _cur;   // before _base
+
+        public:
+        typedef Key                             value_type;
+        typedef std::ptrdiff_t                  difference_type;
+        typedef const Key*                      pointer;
+        typedef const Key&                      reference;
+        typedef std::bidirectional_iterator_tag iterator_category;
+
+        const_reverse_iterator() {}
+        explicit const_reverse_iterator(const_iterator it): _base(it), _cur(it) {}
+
+        const_iterator base() const { return _base; }
+
+        reference operator * () const { return *_prev(); }
+        pointer   operator -> () const { return &*_prev(); }
+
+        const_reverse_iterator& operator++() { --_base; return *this; }
+        const_reverse_iterator  operator++(int) { const_reverse_iterator copy(*this); --_base; return copy; }
+        const_reverse_iterator& operator--() { ++_base; return *this; }
+        const_reverse_iterator  operator--(int) { const_reverse_iterator copy(*this); ++_base; return copy; }
+
+        friend bool operator==(const const_reverse_iterator &a, const const_reverse_iterator &b) {
+            return a._base == b._base;
+        }
+        friend bool operator!=(const const_reverse_iterator &a, const const_reverse_iterator &b) {
+            return a._base != b._base;
+        }
+
+        private:
+        const const_iterator &_prev() const {
+            _cur = _base;
+            return --_cur;
+        }
+    };
+
+    typedef const_reverse_iterator  reverse_iterator;
+
+    /*
+     * **************************************
+     * ************ Variables ***************
+     * **************************************
+    */
+
+private:
+    chunk_vector            _chunks;
+    allocator_type          _al;
+    word_allocator_type     _wal;
+    size_type               _sz;
+
+    /*
+     * **************************************
+     * ********* Private Functions **********
+     * **************************************
+    */
+
+    // ***** keys *****
+    static bits_type _high(const key_type &k) { return int_key<Key>::to_bits(k) >> low_bits; }
+    static unsigned  _low(const key_type &k) {
+        return static_cast<low_type>(int_key<Key>::to_bits(k));
+    }
+
+    // ***** reading a chunk *****
+    static low_type *_lows(const chunk_type &c) { return reinterpret_cast<low_type *>(c.data); }
+
+    // first run whose last key isn't below low
+    static unsigned _run_of(const chunk_type &c, unsigned low) {
+        const low_type *r = _lows(c);
+        unsigned lo = 0;
+        unsigned hi = c.len;
+        while (lo < hi){
+            unsigned mid = (lo + hi) / 2;
+            if (r[2 * mid + 1] < low)
+                lo = mid + 1;
+            else
+                hi = mid;
+        }
+        return lo;
+    }
+
+    static bool _contains(const chunk_type &c, unsigned low) {
+        switch (c.kind) {
+        case array_kind: {
+            const low_type *a = _lows(c);
+            const low_type *at = std::lower_bound(a, a + c.len, low);
+            return at != a + c.len && *at == low;
+        }
+        case bitmap_kind:
+            return c.data[low >> 6] >> (low & 63) & 1;
+        default: {
+            unsigned i = _run_of(c, low);
+            return i < c.len && _lows(c)[2 * i] <= low;
+        }
+        }
+    }
+
+    // low becomes the first key of c not below it (pos its place),
+    // false if none
+    static bool _seek(const chunk_type &c, unsigned &low, unsigned &pos) {
+        switch (c.kind) {
+        case array_kind: {
+            const low_type *a = _lows(c);
+            pos = static_cast<unsigned>(std::lower_bound(a, a + c.len, low) - a);
+            if (pos == c.len)
+                return false;
+            low = a[pos];
+            return true;
+        }
+        case bitmap_kind:
+            pos = 0;
+            for (unsigned w = low >> 6; w < bitmap_words; ++w){
+                word_type bits = c.data[w];
+                if (w == low >> 6)
+                    bits &= ~static_cast<word_type>(0) << (low & 63);
+                if (bits){
+                    low = w * 64 + __builtin_ctzll(bits);
+                    return true;
+                }
+            }
+            return false;
+        default: {
+            pos = _run_of(c, low);
+            if (pos == c.len)
+                return false;
+            if (_lows(c)[2 * pos] > low)
+                low = _lows(c)[2 * pos];
+            return true;
+        }
+        }
+    }
+
+    // key after low in c, false if none
+    static bool _next(const chunk_type &c, unsigned &pos, unsigned &low) {
+        switch (c.kind) {
+        case array_kind:
+            if (++pos == c.len)
+                return false;
+            low = _lows(c)[pos];
+            return true;
+        case bitmap_kind: {
+            unsigned next = low + 1;
+            if (!_seek(c, next, pos))
+                return false;
+            low = next;
+            return true;
+        }
+        default: {
+            const low_type *r = _lows(c);
+            if (low < r[2 * pos + 1])
+                ++low;
+            else if (++pos < c.len)
+                low = r[2 * pos];
+            else
+                return false;
+            return true;
+        }
+        }
+    }
+
+    // key before low in c, false if none
+    static bool _prev(const chunk_type &c, unsigned &pos, unsigned &low) {
+        switch (c.kind) {
+        case array_kind:
+            if (!pos)
+                return false;
+            low = _lows(c)[--pos];
+            return true;
+        case bitmap_kind: {
+            if (!low)
+                return false;
+            unsigned w = (low - 1) >> 6;
+            word_type bits = c.data[w] & ~static_cast<word_type>(0) >> (63 - ((low - 1) & 63));
+            while (!bits){
+                if (!w)
+                    return false;
+                bits = c.data[--w];
+            }
+            low = w * 64 + 63 - __builtin_clzll(bits);
+            return true;
+        }
+        default: {
+            const low_type *r = _lows(c);
+            if (low > r[2 * pos])
+                --low;
+            else if (pos)
+                low = r[2 * --pos + 1];
+            else
+                return false;
+            return true;
+        }
+        }
+    }
+
+    static void _last(const chunk_type &c, unsigned &pos, unsigned &low) {
+        low = 1u << low_bits;
+        pos = c.len;
+        if (c.kind == array_kind)
+            low = _lows(c)[--pos];
+        else if (c.kind == run_kind)
+            low = _lows(c)[2 * --pos + 1];
+        else
+            _prev(c, pos, low);
+    }
+
+    // ***** chunk memory *****
+    word_type *_alloc_words(unsigned n) { return _wal.allocate(n); }
+
+    void _free(chunk_type &c) { _wal.deallocate(c.data, c.cap); }
+
+    chunk_type _new_chunk(bits_type high, kind_type kind, unsigned words) {
+        chunk_type c;
+        c.high = high;
+        c.data = _alloc_words(words);
+        c.card = 0;
+        c.len = 0;
+        c.cap = words;
+        c.kind = kind;
+        return c;
+    }
+
+    // c holds at least lows values
+    void _make_room(chunk_type &c, unsigned lows) {
+        unsigned words = (lows + 3) / 4;
+        if (words <= c.cap)
+            return;
+        if (words < 2 * c.cap)
+            words = 2 * c.cap;
+        word_type *data = _alloc_words(words);
+        std::memcpy(data, c.data, c.cap * sizeof(word_type));
+        _free(c);
+        c.data = data;
+        c.cap = words;
+    }
+
+    // ***** chunk forms *****
+    // c's keys written to the new data, then c takes it
+    void _replace(chunk_type &c, word_type *data, unsigned words, kind_type kind, unsigned len) {
+        _free(c);
+        c.data = data;
+        c.cap = words;
+        c.kind = kind;
+        c.len = len;
+    }
+
+    void _to_bitmap(chunk_type &c) {
+        word_type *data = _alloc_words(bitmap_words);
+        std::memset(data, 0, bitmap_words * sizeof(word_type));
+        unsigned pos;
+        unsigned low = 0;
+        for (bool more = _seek(c, low, pos); more; more = _next(c, pos, low))
+            data[low >> 6] |= static_cast<word_type>(1) << (low & 63);
+        _replace(c, data, bitmap_words, bitmap_kind, bitmap_words);
+    }
+
+    // c has array_max keys at most
+    void _to_array(chunk_type &c) {
+        unsigned words = (c.card + 3) / 4;
+        word_type *data = _alloc_words(words);
+        low_type *a = reinterpret_cast<low_type *>(data);
+        unsigned pos;
+        unsigned low = 0;
+        unsigned n = 0;
+        for (bool more = _seek(c, low, pos); more; more = _next(c, pos, low))
+            a[n++] = static_cast<low_type>(low);
+        _replace(c, data, words, array_kind, n);
+    }
+
+    void _to_runs(chunk_type &c, unsigned runs) {
+        unsigned words = (2 * runs + 3) / 4;
+        word_type *data = _alloc_words(words);
+        low_type *r = reinterpret_cast<low_type *>(data);
+        unsigned pos;
+        unsigned low = 0;
+        unsigned n = 0;
+        for (bool more = _seek(c, low, pos); more; more = _next(c, pos, low)){
+            if (n && r[2 * n - 1] + 1u == low)
+                r[2 * n - 1] = static_cast<low_type>(low);
+            else {
+                r[2 * n] = static_cast<low_type>(low);
+                r[2 * n++ + 1] = static_cast<low_type>(low);
+            }
+        }
+        _replace(c, data, words, run_kind, n);
+    }
+
+    static unsigned _count_runs(const chunk_type &c) {
+        if (c.kind == run_kind)
+            return c.len;
+        unsigned runs = 0;
+        if (c.kind == array_kind){
+            const low_type *a = _lows(c);
+            for (unsigned i = 0; i < c.len; ++i)
+                runs += !i || a[i - 1] + 1u != a[i];
+            return runs;
+        }
+        // a run starts at each set bit whose previous bit is clear
+        word_type carry = 0;
+        for (unsigned w = 0; w < bitmap_words; ++w){
+            word_type bits = c.data[w];
+            runs += __builtin_popcountll(bits & ~(bits << 1 | carry));
+            carry = bits >> 63;
+        }
+        return runs;
+    }
+
+    // smallest form for c's keys, and no unused memory
+    void _shrink(chunk_type &c) {
+        unsigned runs = _count_runs(c);
+        unsigned array_bytes = c.card <= array_max ? 2 * c.card : ~0u;
+        unsigned bitmap_bytes = bitmap_words * sizeof(word_type);
+        unsigned run_bytes = 4 * runs;
+
+        if (run_bytes < array_bytes && run_bytes < bitmap_bytes)
+            _to_runs(c, runs);
+        else if (array_bytes <= bitmap_bytes)
+            _to_array(c);
+        else if (c.kind != bitmap_kind)
+            _to_bitmap(c);
+    }
+
+    // ***** chunk changes *****
+    bool _chunk_insert(chunk_type &c, unsigned low) {
+        switch (c.kind) {
+        case array_kind: {
+            low_type *a = _lows(c);
+            unsigned pos = static_cast<unsigned>(std::lower_bound(a, a + c.len, low) - a);
+            if (pos < c.len && a[pos] == low)
+                return false;
+            if (c.len == array_max){
+                _to_bitmap(c);
+                return _chunk_insert(c, low);
+            }
+            _make_room(c, c.len + 1);
+            a = _lows(c);
+            std::memmove(a + pos + 1, a + pos, (c.len - pos) * sizeof(low_type));
+            a[pos] = static_cast<low_type>(low);
+            ++c.len;
+            break;
+        }
+        case bitmap_kind: {
+            word_type bit = static_cast<word_type>(1) << (low & 63);
+            if (c.data[low >> 6] & bit)
+                return false;
+            c.data[low >> 6] |= bit;
+            break;
+        }
+        default: {
+            low_type *r = _lows(c);
+            unsigned i = _run_of(c, low);
+            if (i < c.len && r[2 * i] <= low)
+                return false;
+            bool to_prev = i > 0 && r[2 * i - 1] + 1u == low;
+            bool to_next = i < c.len && r[2 * i] == low + 1;
+            if (to_prev && to_next){
+                r[2 * i - 1] = r[2 * i + 1];
+                std::memmove(r + 2 * i, r + 2 * i + 2, (c.len - i - 1) * 2 * sizeof(low_type));
+                --c.len;
+            }
+            else if (to_prev)
+                r[2 * i - 1] = static_cast<low_type>(low);
+            else if (to_next)
+                r[2 * i] = static_cast<low_type>(low);
+            else if (c.len == run_max){
+                _to_bitmap(c);
+                return _chunk_insert(c, low);
+            }
+            else {
+                _make_room(c, 2 * c.len + 2);
+                r = _lows(c);
+                std::memmove(r + 2 * i + 2, r + 2 * i, (c.len - i) * 2 * sizeof(low_type));
+                r[2 * i] = static_cast<low_type>(low);
+                r[2 * i + 1] = static_cast<low_type>(low);
+                ++c.len;
+            }
+        }
+        }
+        ++c.card;
+        return true;
+    }
+
+    bool _chunk_erase(chunk_type &c, unsigned low) {
+        switch (c.kind) {
+        case array_kind: {
+            low_type *a = _lows(c);
+            unsigned pos = static_cast<unsigned>(std::lower_bound(a, a + c.len, low) - a);
+            if (pos == c.len || a[pos] != low)
+                return false;
+            std::memmove(a + pos, a + pos + 1, (c.len - pos - 1) * sizeof(low_type));
+            --c.len;
+            break;
+        }
+        case bitmap_kind: {
+            word_type bit = static_cast<word_type>(1) << (low & 63);
+            if (!(c.data[low >> 6] & bit))
+                return false;
+            c.data[low >> 6] &= ~bit;
+            if (--c.card == array_max)
+                _to_array(c);
+            return true;
+        }
+        default: {
+            low_type *r = _lows(c);
+            unsigned i = _run_of(c, low);
+            if (i == c.len || r[2 * i] > low)
+                return false;
+            if (r[2 * i] == r[2 * i + 1]){
+                std::memmove(r + 2 * i, r + 2 * i + 2, (c.len - i - 1) * 2 * sizeof(low_type));
+                --c.len;
+            }
+            else if (r[2 * i] == low)
+                ++r[2 * i];
+            else if (r[2 * i + 1] == low)
+                --r[2 * i + 1];
+            else if (c.len == run_max){
+                _to_bitmap(c);
+                return _chunk_erase(c, low);
+            }
+            else {
+                // the run is cut in two around low
+                _make_room(c, 2 * c.len + 2);
+                r = _lows(c);
+                std::memmove(r + 2 * i + 2, r + 2 * i, (c.len - i) * 2 * sizeof(low_type));
+                r[2 * i + 1] = static_cast<low_type>(low - 1);
+                r[2 * i + 2] = static_cast<low_type>(low + 1);
+                ++c.len;
+            }
+        }
+        }
+        --c.card;
+        return true;
+    }
+
+    chunk_type _copy_chunk(const chunk_type &c) {
+        chunk_type cpy = c;
+        cpy.data = _alloc_words(c.cap);
+        std::memcpy(cpy.data, c.data, c.cap * sizeof(word_type));
+        return cpy;
+    }
+
+    // place of the chunk of high, or where it would go
+    size_type _chunk_of(bits_type high) const {
+        size_type lo = 0;
+        size_type hi = _chunks.size();
+        while (lo < hi){
+            size_type mid = (lo + hi) / 2;
+            if (_chunks[mid].high < high)
+                lo = mid + 1;
+            else
+                hi = mid;
+        }
+        return lo;
+    }
+
+    // ***** set algebra *****
+    enum op_type { union_op, intersection_op, difference_op };
+
+    // c's keys as a bitmap: its own words, or tmp filled
+    static const word_type *_words(const chunk_type &c, word_type *tmp) {
+        if (c.kind == bitmap_kind)
+            return c.data;
+        std::memset(tmp, 0, bitmap_words * sizeof(word_type));
+        unsigned pos;
+        unsigned low = 0;
+        for (bool more = _seek(c, low, pos); more; more = _next(c, pos, low))
+            tmp[low >> 6] |= static_cast<word_type>(1) << (low & 63);
+        return tmp;
+    }
+
+    // x op y, appended to this set when not empty. Sorted arrays are
+    // merged, a small array is filtered by the other chunk, anything
+    // else is done on bitmaps 64 keys at a time
+    void _push_op(const chunk_type &x, const chunk_type &y, op_type op) {
+        chunk_type c;
+
+        if (x.kind == array_kind && y.kind == array_kind)
+            c = _merge_arrays(x, y, op);
+        else if (op != union_op && x.kind == array_kind)
+            c = _filter_array(x, y, op == intersection_op);
+        else if (op == intersection_op && y.kind == array_kind)
+            c = _filter_array(y, x, true);
+        else {
+            word_type tmp_x[bitmap_words];
+            word_type tmp_y[bitmap_words];
+            const word_type *wx = _words(x, tmp_x);
+            const word_type *wy = _words(y, tmp_y);
+            c = _new_chunk(x.high, bitmap_kind, bitmap_words);
+            word_type *w = c.data;
+            switch (op) {
+            case union_op:
+                for (unsigned i = 0; i < bitmap_words; ++i)
+                    w[i] = wx[i] | wy[i];
+                break;
+            case intersection_op:
+                for (unsigned i = 0; i < bitmap_words; ++i)
+                    w[i] = wx[i] & wy[i];
+                break;
+            default:
+                for (unsigned i = 0; i < bitmap_words; ++i)
+                    w[i] = wx[i] & ~wy[i];
+            }
+            for (unsigned i = 0; i < bitmap_words; ++i)
+                c.card += __builtin_popcountll(w[i]);
+            c.len = bitmap_words;
+            if (c.card && c.card <= array_max){
+                try { _to_array(c); }
+                catch (...) { _free(c); throw; }
+            }
+        }
+        _push(c);
+    }
+
+    chunk_type _merge_arrays(const chunk_type &x, const chunk_type &y, op_type op) {
+        chunk_type c = _new_chunk(x.high, array_kind,
+                                  op == union_op ? (x.len + y.len + 3) / 4 : (x.len + 3) / 4);
+        const low_type *a = _lows(x);
+        const low_type *b = _lows(y);
+        low_type *out = _lows(c);
+        unsigned i = 0;
+        unsigned j = 0;
+        while (i < x.len && j < y.len){
+            if (a[i] < b[j]){
+                if (op != intersection_op)
+                    out[c.len++] = a[i];
+                ++i;
+            }
+            else if (b[j] < a[i]){
+                if (op == union_op)
+                    out[c.len++] = b[j];
+                ++j;
+            }
+            else {
+                if (op != difference_op)
+                    out[c.len++] = a[i];
+                ++i;
+                ++j;
+            }
+        }
+        if (op != intersection_op)
+            while (i < x.len)
+                out[c.len++] = a[i++];
+        if (op == union_op)
+            while (j < y.len)
+                out[c.len++] = b[j++];
+        c.card = c.len;
+        if (c.card > array_max){
+            try { _to_bitmap(c); }
+            catch (...) { _free(c); throw; }
+        }
+        return c;
+    }
+
+    // keys of the array x that are (or aren't) in y
+    chunk_type _filter_array(const chunk_type &x, const chunk_type &y, bool in) {
+        chunk_type c = _new_chunk(x.high, array_kind, (x.len + 3) / 4);
+        const low_type *a = _lows(x);
+        low_type *out = _lows(c);
+        for (unsigned i = 0; i < x.len; ++i)
+            if (_contains(y, a[i]) == in)
+                out[c.len++] = a[i];
+        c.card = c.len;
+        return c;
+    }
+
+    // appends c, or frees it when empty or when it can't be appended
+    void _push(chunk_type &c) {
+        if (!c.card)
+            return _free(c);
+        try { _chunks.push_back(c); }
+        catch (...) { _free(c); throw; }
+        _sz += c.card;
+    }
+
+    void _push_copy(const chunk_type &c) {
+        chunk_type cpy = _copy_chunk(c);
+        _push(cpy);
+    }
+
+    // both chunk lists walked at once by high part
+    void _algebra(const int_set &lhs, const int_set &rhs, op_type op) {
+        const chunk_vector &a = lhs._chunks;
+        const chunk_vector &b = rhs._chunks;
+        size_type i = 0;
+        size_type j = 0;
+
+        while (i < a.size()){
+            if (j == b.size() || a[i].high < b[j].high){
+                if (op != intersection_op)
+                    _push_copy(a[i]);
+                ++i;
+            }
+            else if (b[j].high < a[i].high){
+                if (op == union_op)
+                    _push_copy(b[j]);
+                ++j;
+            }
+            else
+                _push_op(a[i++], b[j++], op);
+        }
+        if (op == union_op)
+            for (; j < b.size(); ++j)
+                _push_copy(b[j]);
+    }
+
+    bool _includes(const int_set &other) const {
+        size_type i = 0;
+        for (size_type j = 0; j < other._chunks.size(); ++j){
+            const chunk_type &y = other._chunks[j];
+            while (i < _chunks.size() && _chunks[i].high < y.high)
+                ++i;
+            if (i == _chunks.size() || _chunks[i].high != y.high || _chunks[i].card < y.card)
+                return false;
+            const chunk_type &x = _chunks[i];
+            if (x.kind == bitmap_kind && y.kind == bitmap_kind){
+                for (unsigned w = 0; w < bitmap_words; ++w)
+                    if (y.data[w] & ~x.data[w])
+                        return false;
+                continue;
+            }
+            unsigned pos;
+            unsigned low = 0;
+            for (bool more = _seek(y, low, pos); more; more = _next(y, pos, low))
+                if (!_contains(x, low))
+                    return false;
+        }
+        return true;
+    }
+
+    /*
+     * **************************************
+     * ********* Member Functions ***********
+     * **************************************
+    */
+
+public:
+
+    // ***** Constructors *****
+    //
+    // Default
+    explicit int_set (const key_compare& comp = key_compare(),
+                      const allocator_type& alloc = allocator_type()) :
+        _chunks(chunk_allocator_type(alloc)), _al(alloc), _wal(alloc), _sz(0)
+    { (void)comp; }
+
+    // Range
+    template< class InputIt >
+    int_set (InputIt first, InputIt last,
+             const key_compare& comp = key_compare(),
+             const allocator_type& alloc = allocator_type()) :
+        _chunks(chunk_allocator_type(alloc)), _al(alloc), _wal(alloc), _sz(0)
+    {
+        (void)comp;
+        try { insert(first, last); }
+        catch (...) { clear(); throw; }
+    }
+
+    // Copy
+    int_set (const int_set & cpy):
+        _chunks(chunk_allocator_type(cpy._al)), _al(cpy._al), _wal(cpy._wal), _sz(0)
+    {
+        try { *this = cpy; }
+        catch (...) { clear(); throw; }
+    }
+
+
+    // ***** Destructor *****
+    ~int_set() { clear(); }
+
+
+    // ***** Assignment operator *****
+    int_set& operator=(const int_set& other){
+        if (&other != this){
+            clear();
+            _chunks.reserve(other._chunks.size());
+            for (size_type i = 0; i < other._chunks.size(); ++i)
+                _push_copy(other._chunks[i]);
+        }
+        return *this;
+    }
+
+    // ***** Get_allocator *****
+    allocator_type get_allocator() const { return _al; }
+
+    /*
+     * **************************************
+     * ************* Iterator ***************
+     * **************************************
+    */
+
+    const_iterator begin() const { return const_iterator(&_chunks, 0); }
+    const_iterator end() const { return const_iterator(&_chunks, _chunks.size()); }
+
+    const_reverse_iterator rbegin() const { return const_reverse_iterator(end()); }
+    const_reverse_iterator rend() const { return const_reverse_iterator(begin()); }
+
+    /*
+     * **************************************
+     * ************* Capacity ***************
+     * **************************************
+    */
+
+    bool empty() const { return !_sz; }
+
+    size_type size() const { return _sz; }
+
+    // every key can be there
+    size_type max_size() const {
+        if (sizeof(Key) >= sizeof(size_type))
+            return std::numeric_limits<size_type>::max();
+        return static_cast<size_type>(1) << (8 * sizeof(Key) % (8 * sizeof(size_type)));
+    }
+
+    /*
+     * **************************************
+     * ************ Modifiers ***************
+     * **************************************
+    */
+
+    // ***** Clear *****
+    void clear(){
+        for (size_type i = 0; i < _chunks.size(); ++i)
+            _free(_chunks[i]);
+        _chunks.clear();
+        _sz = 0;
+    }
+
+    // ***** Insert *****
+    // A new chunk is taken back if x can't be put in it: no chunk is
+    // ever left empty
+    ft::pair<iterator, bool> insert(const value_type & x){
+        bits_type high = _high(x);
+        unsigned low = _low(x);
+        size_type at = _chunk_of(high);
+
+        if (at == _chunks.size() || _chunks[at].high != high){
+            chunk_type c = _new_chunk(high, array_kind, 1);
+            try { _chunks.insert(_chunks.begin() + at, c); }
+            catch (...) { _free(c); throw; }
+        }
+        bool inserted;
+        try { inserted = _chunk_insert(_chunks[at], low); }
+        catch (...) {
+            if (!_chunks[at].card){
+                _free(_chunks[at]);
+                _chunks.erase(_chunks.begin() + at);
+            }
+            throw;
+        }
+        _sz += inserted;
+        unsigned pos;
+        _seek(_chunks[at], low, pos);
+        return ft::make_pair(iterator(&_chunks, at, pos, low), inserted);
+    }
+
+    // Insert hint
+    iterator insert(iterator pos, const value_type & x){
+        (void)pos;
+        return insert(x).first;
+    }
+
+    // Insert range
+    template< class InputIt >
+    void insert( InputIt first, InputIt last ){
+        for (; first != last; ++first)
+            insert(*first);
+    }
+
+    // ***** erase *****
+    size_type erase(const key_type & key){
+        size_type at = _chunk_of(_high(key));
+
+        if (at == _chunks.size() || _chunks[at].high != _high(key)
+            || !_chunk_erase(_chunks[at], _low(key)))
+            return 0;
+        if (!_chunks[at].card){
+            _free(_chunks[at]);
+            _chunks.erase(_chunks.begin() + at);
+        }
+        --_sz;
+        return 1;
+    }
+
+    void erase(iterator pos){
+        erase(*pos);
+    }
+
+    // keys from *first to before *last
+    void erase(iterator first, iterator last){
+        if (first == last)
+            return;
+        bool to_end = last == end();
+        key_type hi = to_end ? key_type() : *last;
+        for (iterator it = first; it != end() && (to_end || *it < hi); ){
+            key_type k = *it;
+            erase(k);
+            it = lower_bound(k);
+        }
+    }
+
+    // ***** swap *****
+    void swap(int_set& other){
+        _chunks.swap(other._chunks);
+        size_type sz = _sz;
+        _sz = other._sz;
+        other._sz = sz;
+    }
+
+    // ***** shrink_to_fit *****
+    // Each chunk takes its smallest form, runs of consecutive keys
+    // included, and frees its unused memory. Worth it once the set is
+    // built: later inserts may grow it again
+    void shrink_to_fit(){
+        for (size_type i = 0; i < _chunks.size(); ++i)
+            _shrink(_chunks[i]);
+    }
+
+    /*
+     * **************************************
+     * ************** Lookup ****************
+     * **************************************
+    */
+
+    size_type count(const key_type & k) const {
+        size_type at = _chunk_of(_high(k));
+        return at < _chunks.size() && _chunks[at].high == _high(k)
+               && _contains(_chunks[at], _low(k));
+    }
+
+    const_iterator find(const key_type & k) const {
+        const_iterator it = lower_bound(k);
+        return it != end() && *it == k ? it : end();
+    }
+
+    // returns the first element that isn't less than k, or end() if none is found
+    const_iterator lower_bound (const key_type& k) const {
+        size_type at = _chunk_of(_high(k));
+        if (at < _chunks.size() && _chunks[at].high == _high(k)){
+            unsigned low = _low(k);
+            unsigned pos;
+            if (_seek(_chunks[at], low, pos))
+                return const_iterator(&_chunks, at, pos, low);
+            ++at;
+        }
+        return const_iterator(&_chunks, at);
+    }
+
+    // returns the first element that would go after k, or end() if none is found
+    const_iterator upper_bound (const key_type& k) const {
+        const_iterator it = lower_bound(k);
+        if (it != end() && *it == k)
+            ++it;
+        return it;
+    }
+
+    ft::pair<const_iterator,const_iterator> equal_range (const key_type& k) const{
+        return ft::make_pair(lower_bound(k), upper_bound(k));
+    }
+
+    /*
+     * **************************************
+     * ************ Observers ***************
+     * **************************************
+    */
+
+    key_compare   key_comp()   const { return key_compare(); }
+    value_compare value_comp() const { return value_compare(); }
+
+    /*
+     * **************************************
+     * ************ Set algebra *************
+     * **************************************
+    */
+
+    template <class K, class A>
+    friend int_set<K, A> set_union(const int_set<K, A>&, const int_set<K, A>&);
+    template <class K, class A>
+    friend int_set<K, A> set_intersection(const int_set<K, A>&, const int_set<K, A>&);
+    template <class K, class A>
+    friend int_set<K, A> set_difference(const int_set<K, A>&, const int_set<K, A>&);
+    template <class K, class A>
+    friend bool includes(const int_set<K, A>&, const int_set<K, A>&);
+
+};  // --------- End of int_set
+
+
+    /*
+     * **************************************
+     * ** Non member - Relational operator **
+     * **************************************
+    */
+
+template< class Key, class Alloc >
+bool operator==( const ft::int_set<Key, Alloc>& lhs, const ft::int_set<Key, Alloc>& rhs ){
+    return lhs.size() == rhs.size() && ft::equal(lhs.begin(), lhs.end(), rhs.begin());
+}
+
+template< class Key, class Alloc >
+bool operator!=( const ft::int_set<Key, Alloc>& lhs, const ft::int_set<Key, Alloc>& rhs ){
+    return !(lhs == rhs);
+}
+
+template< class Key, class Alloc >
+bool operator<( const ft::int_set<Key, Alloc>& lhs, const ft::int_set<Key, Alloc>& rhs ){
+    return ft::lexicographical_compare(lhs.begin(), lhs.end(),
+                                        rhs.begin(), rhs.end());
+}
+
+template< class Key, class Alloc >
+bool operator>( const ft::int_set<Key, Alloc>& lhs, const ft::int_set<Key, Alloc>& rhs ){
+    return rhs < lhs;
+}
+
+template< class Key, class Alloc >
+bool operator<=( const ft::int_set<Key, Alloc>& lhs, const ft::int_set<Key, Alloc>& rhs ){
+    return !(rhs < lhs);
+}
+
+template< class Key, class Alloc >
+bool operator>=( const ft::int_set<Key, Alloc>& lhs, const ft::int_set<Key, Alloc>& rhs ){
+    return !(lhs < rhs);
+}
+
+template< class Key, class Alloc >
+void swap( ft::int_set<Key, Alloc>& lhs, ft::int_set<Key, Alloc>& rhs ){
+    lhs.swap(rhs);
+}
+
+    /*
+     * **************************************
+     * ****** Non member - Set algebra ******
+     * **************************************
+     *
+     * O(chunks) plus, for chunks in both: O(n + m) for two arrays,
+     * O(n log m) when an array is filtered, 1024 word operations else
+    */
+
+// Elements of both
+template< class Key, class Alloc >
+ft::int_set<Key, Alloc> set_union( const ft::int_set<Key, Alloc>& lhs,
+                                   const ft::int_set<Key, Alloc>& rhs ){
+    ft::int_set<Key, Alloc> ret(lhs.key_comp(), lhs.get_allocator());
+    ret._algebra(lhs, rhs, ret.union_op);
+    return ret;
+}
+
+// Elements of lhs also in rhs
+template< class Key, class Alloc >
+ft::int_set<Key, Alloc> set_intersection( const ft::int_set<Key, Alloc>& lhs,
+                                          const ft::int_set<Key, Alloc>& rhs ){
+    ft::int_set<Key, Alloc> ret(lhs.key_comp(), lhs.get_allocator());
+    ret._algebra(lhs, rhs, ret.intersection_op);
+    return ret;
+}
+
+// Elements of lhs not in rhs
+template< class Key, class Alloc >
+ft::int_set<Key, Alloc> set_difference( const ft::int_set<Key, Alloc>& lhs,
+                                        const ft::int_set<Key, Alloc>& rhs ){
+    ft::int_set<Key, Alloc> ret(lhs.key_comp(), lhs.get_allocator());
+    ret._algebra(lhs, rhs, ret.difference_op);
+    return ret;
+}
+
+// True if every element of rhs is in lhs
+template< class Key, class Alloc >
+bool includes( const ft::int_set<Key, Alloc>& lhs, const ft::int_set<Key, Alloc>& rhs ){
+    return lhs._includes(rhs);
+}
+
+} // --------- End of ft namespace
+
+#endif
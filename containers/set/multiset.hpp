@@ -0,0 +1,138 @@
+#ifndef MULTISET_HPP
+# define MULTISET_HPP
+
+# include "../utils/rb_tree.hpp"  // the tree, see there for everything shared with set
+
+# include <memory>    // needed for std::allocator
+
+namespace ft {
+
+template <
+    class Key,
+    class Compare = std::less<Key>,
+    class Alloc = std::allocator<Key>
+> class multiset : public rb_tree<Key, Key, identity<Key>, Compare, Alloc,
+                                  rb_subtree_size, false> {
+    typedef rb_tree<Key, Key, identity<Key>, Compare, Alloc,
+                    rb_subtree_size, false>  tree_type;
+
+    public:
+
+    /*
+     * **************************************
+     * ********** Member Types **************
+     * **************************************
+    */
+
+    typedef Key                     key_type;
+    typedef Key                     value_type;
+
+    typedef std::ptrdiff_t          difference_type;
+    typedef std::size_t             size_type;
+    typedef Alloc                   allocator_type;
+    typedef value_type&             reference;
+    typedef const value_type&       const_reference;
+
+    typedef typename Alloc::pointer       pointer;
+    typedef typename Alloc::const_pointer const_pointer;
+
+    typedef Compare                 key_compare;
+    typedef Compare                 value_compare;
+
+    typedef typename tree_type::iterator                iterator;
+    typedef typename tree_type::const_iterator          const_iterator;
+    typedef typename tree_type::reverse_iterator        reverse_iterator;
+    typedef typename tree_type::const_reverse_iterator  const_reverse_iterator;
+
+    typedef typename tree_type::node_handle_type        node_handle_type;
+
+    /*
+     * **************************************
+     * ********* Member Functions ***********
+     * **************************************
+    */
+
+    // ***** Constructors *****
+    //
+    // Default
+    explicit multiset (const key_compare& comp = key_compare(),
+                       const allocator_type& alloc = allocator_type()) :
+        tree_type(comp, alloc) {}
+
+    // Range
+    template< class InputIt >
+    multiset (InputIt first, InputIt last,
+              const key_compare& comp = key_compare(),
+              const allocator_type& alloc = allocator_type()) :
+        tree_type(comp, alloc)
+    { this->insert(first, last); }
+
+    // Copy
+    multiset (const multiset & cpy): tree_type(cpy) {}
+
+
+    // ***** Destructor *****
+    ~multiset() {}
+
+
+    // ***** Assignment operator *****
+    multiset& operator=(const multiset& other){
+        tree_type::operator=(other);
+        return *this;
+    }
+
+    /*
+     * **************************************
+     * ************ Modifiers ***************
+     * **************************************
+    */
+
+    // ***** Insert *****
+    // Always inserts, after the equal elements
+    iterator insert(const value_type & x){
+        return tree_type::insert(x).first;
+    }
+
+    // Insert hint
+    iterator insert(iterator pos, const value_type & x){
+        (void)pos;
+        return insert(x);
+    }
+
+    // Insert range
+    template< class InputIt >
+    void insert( InputIt first, InputIt last ){
+        tree_type::insert(first, last);
+    }
+
+    // ***** insert node *****
+    iterator insert(const node_handle_type & nh){
+        return tree_type::insert(nh).position;
+    }
+
+    iterator insert(const_iterator pos, const node_handle_type & nh){
+        return tree_type::insert(pos, nh);
+    }
+
+    /*
+     * **************************************
+     * ************ Observers ***************
+     * **************************************
+    */
+
+    value_compare value_comp() const { return this->key_comp(); }
+
+private:
+    // need unique keys, see rb_tree
+    using tree_type::split;
+    using tree_type::join;
+    using tree_type::parallel_union;
+    using tree_type::parallel_intersection;
+    using tree_type::parallel_difference;
+    using tree_type::insert_batch;
+
+};  // --------- End of multiset
+
+} // --------- End of ft namespace
+
+#endif
@@ -0,0 +1,239 @@
+#ifndef CONCURRENT_STACK_HPP
+# define CONCURRENT_STACK_HPP
+
+# include <memory> // needed for std::allocator
+
+// atomic builtins wrappers
+# include "../utils/atomic.hpp"
+
+namespace ft {
+
+/*
+ * Lock-free stack (Treiber stack), can be shared between threads.
+ *
+ * Nodes are never given back to the allocator before destruction:
+ * popped nodes go to a free list and are reused by the next pushes,
+ * so a thread reading a node that was just popped by an other one
+ * still reads valid memory.
+ * Both list heads are tagged pointers, the tag being incremented on
+ * each update so a head popped and pushed back between the read and
+ * the compare and swap (ABA) makes the compare and swap fail.
+ * The tag lives in the unused upper bits of the pointer (16 bits on
+ * 64 bits platforms, which only use 48 bits of address space).
+ *
+ * There is no top(): an other thread could pop it while it's read,
+ * try_pop() copies the element out instead.
+*/
+template<
+    class T,
+    class Alloc = std::allocator<T>
+> class concurrent_stack {
+
+public:
+
+    /*
+     * **************************************
+     * ********** Member Types **************
+     * **************************************
+    */
+
+    typedef T                   value_type;
+    typedef Alloc               allocator_type;
+    typedef std::size_t         size_type;
+    typedef value_type&         reference;
+    typedef const value_type&   const_reference;
+
+private:
+
+    struct node_type {
+        value_type * val;   // allocated once, constructed on each push
+        node_type  * next;
+    };
+
+    typedef unsigned long long  tagged_type;
+
+    typedef typename Alloc::template rebind<node_type>::other   node_allocator_type;
+
+    /*
+     * **************************************
+     * ************ Variables ***************
+     * **************************************
+    */
+
+    // heads are on their own cache line, both are hammered
+    volatile tagged_type    _head;
+    char                    _pad_head[FT_CACHELINE - sizeof(tagged_type)];
+    volatile tagged_type    _free;
+    char                    _pad_free[FT_CACHELINE - sizeof(tagged_type)];
+    volatile size_type      _sz;
+    allocator_type          _al;
+    node_allocator_type     _node_al;
+
+    // Not copyable, a copy couldn't be made atomically
+    concurrent_stack(const concurrent_stack &);
+    concurrent_stack& operator=(const concurrent_stack &);
+
+    /*
+     * **************************************
+     * ********** Tagged pointers ***********
+     * **************************************
+    */
+
+    static unsigned int _ptr_bits() { return sizeof(void*) == 8 ? 48 : 32; }
+
+    static tagged_type _pack(node_type *n, tagged_type tag) {
+        return static_cast<tagged_type>(reinterpret_cast<std::size_t>(n))
+               | (tag << _ptr_bits());
+    }
+
+    static node_type * _ptr(tagged_type t) {
+        tagged_type mask = (static_cast<tagged_type>(1) << _ptr_bits()) - 1;
+        return reinterpret_cast<node_type *>(static_cast<std::size_t>(t & mask));
+    }
+
+    static tagged_type _tag(tagged_type t) { return t >> _ptr_bits(); }
+
+    /*
+     * **************************************
+     * ********* Private Functions **********
+     * **************************************
+    */
+
+    // Pushes n on top of the list starting at head
+    static void _push_node(volatile tagged_type *head, node_type *n) {
+        tagged_type old = atomic_load(head, mo_relaxed);
+        do {
+            atomic_store(&n->next, _ptr(old), mo_relaxed);
+        } while (!atomic_cas(head, old, _pack(n, _tag(old) + 1), mo_release));
+    }
+
+    // Pops the top node of the list starting at head, NULL if empty
+    static node_type * _pop_node(volatile tagged_type *head) {
+        tagged_type old = atomic_load(head);
+        node_type   *n;
+        while ((n = _ptr(old))) {
+            // n may be popped by an other thread meanwhile, next is then
+            // garbage but the tag changed so the exchange below fails
+            node_type *next = atomic_load(&n->next, mo_relaxed);
+            if (atomic_cas(head, old, _pack(next, _tag(old) + 1), mo_acquire))
+                return n;
+        }
+        return NULL;
+    }
+
+    node_type * _new_node() {
+        node_type *n = _node_al.allocate(1);
+        try { n->val = _al.allocate(1); }
+        catch (...) { _node_al.deallocate(n, 1); throw; }
+        n->next = NULL;
+        return n;
+    }
+
+    // Reuses a node from the free list, or allocates one
+    node_type * _get_node() {
+        node_type *n = _pop_node(&_free);
+        return n ? n : _new_node();
+    }
+
+    void _free_list(volatile tagged_type *head) {
+        node_type *n;
+        while ((n = _pop_node(head))) {
+            _al.deallocate(n->val, 1);
+            _node_al.deallocate(n, 1);
+        }
+    }
+
+public:
+
+    /*
+     * **************************************
+     * ********* Member Functions ***********
+     * **************************************
+    */
+
+    // ***** Constructors *****
+
+    explicit concurrent_stack(const allocator_type& alloc = allocator_type()):
+        _head(0), _free(0), _sz(0), _al(alloc), _node_al(alloc) {}
+
+    // ***** Destructor *****
+    // No other thread may use the stack anymore
+    ~concurrent_stack() {
+        node_type *n;
+        while ((n = _pop_node(&_head))) {
+            _al.destroy(n->val);
+            _push_node(&_free, n);
+        }
+        _free_list(&_free);
+    }
+
+    /*
+     * **************************************
+     * ************* Capacity ***************
+     * **************************************
+    */
+
+    // ***** empty *****
+    // Only a snapshot, an other thread may push or pop right after
+    bool empty() const { return !_ptr(atomic_load(&_head)); }
+
+    // ***** size *****
+    // Same as empty(), approximate when other threads are running:
+    // it may count the pushes in progress, never goes below zero
+    size_type size() const { return atomic_load(&_sz, mo_relaxed); }
+
+    // ***** reserve *****
+    // Preallocates nodes so the next n pushes don't allocate
+    void reserve(size_type n) {
+        while (n--)
+            _push_node(&_free, _new_node());
+    }
+
+    /*
+     * **************************************
+     * ************ Modifiers ***************
+     * **************************************
+    */
+
+    // ***** push *****
+    void push(const value_type& value) {
+        node_type *n = _get_node();
+        try { _al.construct(n->val, value); }
+        catch (...) { _push_node(&_free, n); throw; }
+        // counted before it is published: a pop can't decrement it first
+        atomic_fetch_add(&_sz, static_cast<size_type>(1), mo_relaxed);
+        _push_node(&_head, n);
+    }
+
+    // ***** try_pop *****
+    // Copies the top element in out and removes it,
+    // returns false if the stack was empty
+    bool try_pop(value_type& out) {
+        node_type *n = _pop_node(&_head);
+        if (!n)
+            return false;
+        atomic_fetch_sub(&_sz, static_cast<size_type>(1), mo_relaxed);
+        try { out = *n->val; }
+        catch (...) { _al.destroy(n->val); _push_node(&_free, n); throw; }
+        _al.destroy(n->val);
+        _push_node(&_free, n);
+        return true;
+    }
+
+    // ***** pop *****
+    // Removes the top element, returns false if the stack was empty
+    bool pop() {
+        node_type *n = _pop_node(&_head);
+        if (!n)
+            return false;
+        atomic_fetch_sub(&_sz, static_cast<size_type>(1), mo_relaxed);
+        _al.destroy(n->val);
+        _push_node(&_free, n);
+        return true;
+    }
+
+};
+// End of concurrent_stack scope
+
+}
+#endif
@@ -1,14 +1,16 @@
 #ifndef STACK_HPP
 # define STACK_HPP
 
-// Default underlying container is vector
+// Default underlying container is deque
+# include "../deque/deque.hpp"
+// vector is still a valid underlying container
 # include "../vector/vector.hpp"
 
 namespace ft {
 
 template<
     class T,
-    class Container = ft::vector<T>
+    class Container = ft::deque<T>
 > class stack {
 
 public:
@@ -82,6 +84,10 @@ public:
     // ***** size *****
     size_type size() const { return c.size(); }
 
+    // ***** shrink_to_fit *****
+    // Releases the memory the underlying container kept after a spike
+    void shrink_to_fit() { c.shrink_to_fit(); }
+
     /*
      * **************************************
      * ************ Modifiers ***************
@@ -0,0 +1,783 @@
+#ifndef STRING_HPP
+# define STRING_HPP
+
+# include <memory>      // needed for std::allocator
+# include <string>      // needed for std::char_traits
+# include <cstring>     // needed for memcpy
+# include <stdexcept>   // needed for out_of_range, length_error
+# include <sstream>     // needed for the message of at()
+# include <functional>  // needed for std::less
+# include <algorithm>   // needed for std::min, std::max
+# include <ostream>
+# include <istream>
+
+// type_traits, contains enable_if, is_integral, is_trivially_relocatable
+# include "../utils/type_traits.hpp"
+// iterators, contains reverse_iterator
+# include "../utils/iterators.hpp"
+// pair, contains compressed_pair
+# include "../utils/pair.hpp"
+// iterators, same as vector's
+# include "../vector/vec_iterator.hpp"
+
+namespace ft
+{
+
+/*
+ * basic_string, with string as basic_string<char>.
+ *
+ * Short strings, up to local_cap characters (15 for char), are kept in
+ * the object itself, in the place of the heap pointer and capacity.
+ * The top bit of the size tells which of the two is used, which keeps
+ * the object at 24 bytes.
+ * Nothing points into the object, so it is trivially relocatable:
+ * vector<string> reallocates with a memcpy, and copying a short string
+ * is copying its bytes.
+*/
+template <class CharT, class Traits = std::char_traits<CharT>, class Alloc = std::allocator<CharT> >
+class basic_string
+{
+public:
+
+    /*
+     * **************************************
+     * ********** Member Types **************
+     * **************************************
+    */
+
+    typedef Traits      traits_type;
+    typedef CharT       value_type;
+    typedef Alloc       allocator_type;
+
+    typedef typename allocator_type::reference       reference;
+    typedef typename allocator_type::const_reference const_reference;
+    typedef typename allocator_type::pointer         pointer;
+    typedef typename allocator_type::const_pointer   const_pointer;
+
+    typedef typename allocator_type::size_type       size_type;
+    typedef typename allocator_type::difference_type difference_type;
+
+    /*
+     * **************************************
+     * ********* Iterator Types *************
+     * **************************************
+    */
+
+    typedef vec_iterator<CharT>         iterator;
+    typedef vec_iterator<const CharT>   const_iterator;
+
+    typedef ft::reverse_iterator<iterator>          reverse_iterator;
+    typedef ft::reverse_iterator<const_iterator>    const_reverse_iterator;
+
+    static const size_type npos = static_cast<size_type>(-1);
+
+private:
+
+    // characters kept in the object, one more for the '\0'
+    enum { local_cap = 16 / sizeof(CharT) - 1 };
+
+    /*
+     * **************************************
+     * ************ Variables ***************
+     * **************************************
+    */
+
+    struct heap_type {
+        CharT *     ptr;
+        size_type   cap;
+    };
+
+    // Allocator and size, an empty allocator takes no space.
+    // The size's top bit is set when the characters are on the heap.
+    ft::compressed_pair<allocator_type, size_type>  _al_sz;
+    union {
+        heap_type   _heap;
+        CharT       _local[local_cap + 1];
+    };
+
+    /*
+     * **************************************
+     * ********* Private Functions **********
+     * **************************************
+    */
+
+    static const size_type heap_bit = ~(npos >> 1);
+
+    allocator_type&       _alloc()       { return _al_sz.first(); }
+    const allocator_type& _alloc() const { return _al_sz.first(); }
+
+    bool      _is_local() const { return !(_al_sz.second() & heap_bit); }
+    size_type _size()     const { return _al_sz.second() & ~heap_bit; }
+    size_type _cap()      const { return _is_local() ? size_type(local_cap) : _heap.cap; }
+
+    CharT *       _data()       { return _is_local() ? _local : _heap.ptr; }
+    const CharT * _data() const { return _is_local() ? _local : _heap.ptr; }
+
+    void _free() {
+        if (!_is_local())
+            _alloc().deallocate(_heap.ptr, _heap.cap + 1);
+    }
+
+    void _set_size(size_type n) {
+        _al_sz.second() = n | (_al_sz.second() & heap_bit);
+        traits_type::assign(_data()[n], CharT());
+    }
+
+    // Points into this string, whose memory could move
+    bool _aliases(const CharT *s) const {
+        std::less<const CharT *> less;
+        return !less(s, _data()) && !less(_data() + _size(), s);
+    }
+
+    void _check_pos(size_type pos, const char *where) const {
+        if (pos > _size())
+            throw std::out_of_range(where);
+    }
+
+    void _check_length(size_type len1, size_type len2, const char *where) const {
+        if (max_size() - (_size() - len1) < len2)
+            throw std::length_error(where);
+    }
+
+    // Room for len2 characters in the place of the len1 at pos,
+    // returns where they go
+    CharT *_open(size_type pos, size_type len1, size_type len2) {
+        size_type new_sz = _size() - len1 + len2;
+        size_type tail = _size() - pos - len1;
+        CharT *d = _data();
+
+        if (new_sz > _cap()) {
+            size_type new_cp = std::max(new_sz, 2 * _cap());
+            CharT *p = _alloc().allocate(new_cp + 1);
+            traits_type::copy(p, d, pos);
+            traits_type::copy(p + pos + len2, d + pos + len1, tail);
+            _free();
+            _heap.ptr = p;
+            _heap.cap = new_cp;
+            _al_sz.second() |= heap_bit;
+        }
+        else if (tail && len1 != len2)
+            traits_type::move(d + pos + len2, d + pos + len1, tail);
+        _set_size(new_sz);
+        return _data() + pos;
+    }
+
+    // The len1 characters at pos replaced by the len2 at s
+    basic_string& _replace(size_type pos, size_type len1, const CharT *s, size_type len2) {
+        _check_length(len1, len2, "basic_string::_M_replace");
+        if (len2 && _aliases(s)) {
+            basic_string tmp(s, len2);
+            return _replace(pos, len1, tmp._data(), len2);
+        }
+        traits_type::copy(_open(pos, len1, len2), s, len2);
+        return *this;
+    }
+
+    // The len1 characters at pos replaced by n times c
+    basic_string& _replace(size_type pos, size_type len1, size_type n, CharT c) {
+        _check_length(len1, n, "basic_string::_M_replace_aux");
+        traits_type::assign(_open(pos, len1, n), n, c);
+        return *this;
+    }
+
+    // integer "iterators" are a count and a character
+    template <class InputIt>
+    basic_string& _replace_range(size_type pos, size_type len1, InputIt first, InputIt last,
+                                 typename ft::enable_if<is_integral<InputIt>::value>::type* = 0) {
+        return _replace(pos, len1, static_cast<size_type>(first), static_cast<CharT>(last));
+    }
+
+    template <class InputIt>
+    basic_string& _replace_range(size_type pos, size_type len1, InputIt first, InputIt last,
+                                 typename ft::enable_if<!is_integral<InputIt>::value>::type* = 0) {
+        basic_string tmp(_alloc());
+        for (; first != last; ++first)
+            tmp.push_back(*first);
+        return _replace(pos, len1, tmp._data(), tmp._size());
+    }
+
+    size_type _limit(size_type pos, size_type n) const { return std::min(n, _size() - pos); }
+
+public:
+
+    /*
+     * **************************************
+     * ********* Member Functions ***********
+     * **************************************
+    */
+
+    // ***** Constructors *****
+
+    explicit basic_string(const allocator_type& alloc = allocator_type()):
+        _al_sz(alloc, 0)
+    {
+        traits_type::assign(_local[0], CharT());
+    }
+
+    // Copy: a short string is copied with its bytes
+    basic_string(const basic_string& cpy):
+        _al_sz(cpy._alloc(), cpy._al_sz.second())
+    {
+        if (cpy._is_local())
+            std::memcpy(_local, cpy._local, sizeof(_local));
+        else {
+            _al_sz.second() = 0;
+            assign(cpy._heap.ptr, cpy._size());
+        }
+    }
+
+    basic_string(const basic_string& str, size_type pos, size_type n = npos,
+                 const allocator_type& alloc = allocator_type()):
+        _al_sz(alloc, 0)
+    {
+        str._check_pos(pos, "basic_string::basic_string");
+        traits_type::assign(_local[0], CharT());
+        assign(str._data() + pos, str._limit(pos, n));
+    }
+
+    basic_string(const CharT *s, size_type n, const allocator_type& alloc = allocator_type()):
+        _al_sz(alloc, 0)
+    {
+        traits_type::assign(_local[0], CharT());
+        assign(s, n);
+    }
+
+    basic_string(const CharT *s, const allocator_type& alloc = allocator_type()):
+        _al_sz(alloc, 0)
+    {
+        traits_type::assign(_local[0], CharT());
+        assign(s);
+    }
+
+    basic_string(size_type n, CharT c, const allocator_type& alloc = allocator_type()):
+        _al_sz(alloc, 0)
+    {
+        traits_type::assign(_local[0], CharT());
+        assign(n, c);
+    }
+
+    // Range
+    template <class InputIt>
+    basic_string(InputIt first, InputIt last, const allocator_type& alloc = allocator_type()):
+        _al_sz(alloc, 0)
+    {
+        traits_type::assign(_local[0], CharT());
+        assign(first, last);
+    }
+
+    // ***** Destructor *****
+    ~basic_string() { _free(); }
+
+    // ***** Assignment operators *****
+    // Both short: the bytes are copied
+    basic_string& operator=(const basic_string& str) {
+        if (&str == this)
+            return *this;
+        if (_is_local() && str._is_local()) {
+            std::memcpy(_local, str._local, sizeof(_local));
+            _al_sz.second() = str._al_sz.second();
+            return *this;
+        }
+        return assign(str._data(), str._size());
+    }
+    basic_string& operator=(const CharT *s) { return assign(s); }
+    basic_string& operator=(CharT c) { return assign(1, c); }
+
+    basic_string& assign(const basic_string& str) { return *this = str; }
+    basic_string& assign(const basic_string& str, size_type pos, size_type n) {
+        str._check_pos(pos, "basic_string::assign");
+        return assign(str._data() + pos, str._limit(pos, n));
+    }
+    basic_string& assign(const CharT *s, size_type n) { return _replace(0, _size(), s, n); }
+    basic_string& assign(const CharT *s) { return assign(s, traits_type::length(s)); }
+    basic_string& assign(size_type n, CharT c) { return _replace(0, _size(), n, c); }
+    template <class InputIt>
+    basic_string& assign(InputIt first, InputIt last) { return _replace_range(0, _size(), first, last); }
+
+    /*
+     * **************************************
+     * ************ Iterators ***************
+     * **************************************
+    */
+
+    iterator begin() { return iterator(_data()); }
+    const_iterator begin() const { return const_iterator(_data()); }
+
+    reverse_iterator rbegin() { return reverse_iterator(end()); }
+    const_reverse_iterator rbegin() const { return const_reverse_iterator(end()); }
+
+    iterator end() { return iterator(_data() + _size()); }
+    const_iterator end() const { return const_iterator(_data() + _size()); }
+
+    reverse_iterator rend() { return reverse_iterator(begin()); }
+    const_reverse_iterator rend() const { return const_reverse_iterator(begin()); }
+
+    /*
+     * **************************************
+     * ************* Capacity ***************
+     * **************************************
+    */
+
+    size_type size() const { return _size(); }
+    size_type length() const { return _size(); }
+
+    // the top bit of the size tells where the characters are
+    size_type max_size() const { return (_alloc().max_size() - 1) / 2; }
+
+    void resize(size_type n, CharT c) {
+        if (n > _size())
+            append(n - _size(), c);
+        else
+            _set_size(n);
+    }
+    void resize(size_type n) { resize(n, CharT()); }
+
+    size_type capacity() const { return _cap(); }
+
+    void reserve(size_type n = 0) {
+        if (n > max_size())
+            throw std::length_error("basic_string::reserve");
+        if (n > _cap()) {
+            size_type sz = _size();
+            _open(sz, 0, n - sz);
+            _set_size(sz);
+        }
+    }
+
+    // Back in the object if short enough, to the size on the heap if not
+    void shrink_to_fit() {
+        if (_is_local() || _cap() == _size())
+            return;
+        heap_type old = _heap;
+        if (_size() <= local_cap) {
+            traits_type::copy(_local, old.ptr, _size() + 1);
+            _al_sz.second() = _size();
+        }
+        else {
+            _heap.ptr = _alloc().allocate(_size() + 1);
+            traits_type::copy(_heap.ptr, old.ptr, _size() + 1);
+            _heap.cap = _size();
+        }
+        _alloc().deallocate(old.ptr, old.cap + 1);
+    }
+
+    void clear() { _set_size(0); }
+
+    bool empty() const { return !_size(); }
+
+    /*
+     * **************************************
+     * ********** Element Access ************
+     * **************************************
+    */
+
+    const_reference operator[](size_type pos) const { return _data()[pos]; }
+    reference       operator[](size_type pos)       { return _data()[pos]; }
+
+private:
+    // as std::string when trying at() out of bounds
+    void _at_range_check(size_type n) const {
+        if (n >= _size()) {
+            std::ostringstream msg;
+            msg << "basic_string::at: __n (which is " << n
+                << ") >= this->size() (which is " << _size() << ')';
+            throw std::out_of_range(msg.str());
+        }
+    }
+public:
+    const_reference at(size_type pos) const { _at_range_check(pos); return (*this)[pos]; }
+    reference       at(size_type pos)       { _at_range_check(pos); return (*this)[pos]; }
+
+    const_reference front() const { return (*this)[0]; }
+    reference       front()       { return (*this)[0]; }
+
+    const_reference back() const { return (*this)[_size() - 1]; }
+    reference       back()       { return (*this)[_size() - 1]; }
+
+    /*
+     * **************************************
+     * ************ Modifiers ***************
+     * **************************************
+    */
+
+    basic_string& operator+=(const basic_string& str) { return append(str); }
+    basic_string& operator+=(const CharT *s) { return append(s); }
+    basic_string& operator+=(CharT c) { push_back(c); return *this; }
+
+    basic_string& append(const basic_string& str) { return append(str._data(), str._size()); }
+    basic_string& append(const basic_string& str, size_type pos, size_type n) {
+        str._check_pos(pos, "basic_string::append");
+        return append(str._data() + pos, str._limit(pos, n));
+    }
+    basic_string& append(const CharT *s, size_type n) { return _replace(_size(), 0, s, n); }
+    basic_string& append(const CharT *s) { return append(s, traits_type::length(s)); }
+    basic_string& append(size_type n, CharT c) { return _replace(_size(), 0, n, c); }
+    template <class InputIt>
+    basic_string& append(InputIt first, InputIt last) { return _replace_range(_size(), 0, first, last); }
+
+    void push_back(CharT c) {
+        if (_size() < _cap()) {
+            traits_type::assign(_data()[_size()], c);
+            _set_size(_size() + 1);
+        }
+        else
+            _replace(_size(), 0, 1, c);
+    }
+
+    void pop_back() { _set_size(_size() - 1); }
+
+    basic_string& insert(size_type pos, const basic_string& str) {
+        return insert(pos, str._data(), str._size());
+    }
+    basic_string& insert(size_type pos1, const basic_string& str, size_type pos2, size_type n) {
+        str._check_pos(pos2, "basic_string::insert");
+        return insert(pos1, str._data() + pos2, str._limit(pos2, n));
+    }
+    basic_string& insert(size_type pos, const CharT *s, size_type n) {
+        _check_pos(pos, "basic_string::insert");
+        return _replace(pos, 0, s, n);
+    }
+    basic_string& insert(size_type pos, const CharT *s) { return insert(pos, s, traits_type::length(s)); }
+    basic_string& insert(size_type pos, size_type n, CharT c) {
+        _check_pos(pos, "basic_string::insert");
+        return _replace(pos, 0, n, c);
+    }
+    iterator insert(iterator p, CharT c) {
+        size_type pos = p - begin();
+        _replace(pos, 0, 1, c);
+        return begin() + pos;
+    }
+    void insert(iterator p, size_type n, CharT c) { _replace(p - begin(), 0, n, c); }
+    template <class InputIt>
+    void insert(iterator p, InputIt first, InputIt last) { _replace_range(p - begin(), 0, first, last); }
+
+    basic_string& erase(size_type pos = 0, size_type n = npos) {
+        _check_pos(pos, "basic_string::erase");
+        _open(pos, _limit(pos, n), 0);
+        return *this;
+    }
+    iterator erase(iterator p) { return erase(p, p + 1); }
+    iterator erase(iterator first, iterator last) {
+        size_type pos = first - begin();
+        _open(pos, last - first, 0);
+        return begin() + pos;
+    }
+
+    basic_string& replace(size_type pos, size_type n, const basic_string& str) {
+        return replace(pos, n, str._data(), str._size());
+    }
+    basic_string& replace(size_type pos, size_type n, const CharT *s, size_type n2) {
+        _check_pos(pos, "basic_string::replace");
+        return _replace(pos, _limit(pos, n), s, n2);
+    }
+    basic_string& replace(size_type pos, size_type n, const CharT *s) {
+        return replace(pos, n, s, traits_type::length(s));
+    }
+    basic_string& replace(size_type pos, size_type n, size_type n2, CharT c) {
+        _check_pos(pos, "basic_string::replace");
+        return _replace(pos, _limit(pos, n), n2, c);
+    }
+
+    size_type copy(CharT *s, size_type n, size_type pos = 0) const {
+        _check_pos(pos, "basic_string::copy");
+        n = _limit(pos, n);
+        traits_type::copy(s, _data() + pos, n);
+        return n;
+    }
+
+    // The objects are swapped whole, the heap pointer with them
+    void swap(basic_string& str) {
+        char tmp[sizeof(basic_string)];
+        std::memcpy(tmp, static_cast<void *>(this), sizeof(basic_string));
+        std::memcpy(static_cast<void *>(this), static_cast<void *>(&str), sizeof(basic_string));
+        std::memcpy(static_cast<void *>(&str), tmp, sizeof(basic_string));
+    }
+
+    /*
+     * **************************************
+     * *********** Operations ***************
+     * **************************************
+    */
+
+    const CharT *c_str() const { return _data(); }
+    const CharT *data() const { return _data(); }
+
+    allocator_type get_allocator() const { return _alloc(); }
+
+    // FNV-1a of the characters. Not kept: a reference or an iterator
+    // handed out earlier can still change them
+    size_type hash() const {
+        size_type h = static_cast<size_type>(14695981039346656037ULL);
+        const unsigned char *p = reinterpret_cast<const unsigned char *>(_data());
+        for (size_type i = 0; i < _size() * sizeof(CharT); ++i)
+            h = (h ^ p[i]) * static_cast<size_type>(1099511628211ULL);
+        return h;
+    }
+
+    // ***** Searches *****
+
+    size_type find(const CharT *s, size_type pos, size_type n) const {
+        if (n == 0)
+            return pos <= _size() ? pos : npos;
+        for (; n <= _size() && pos <= _size() - n; ++pos) {
+            const CharT *p = traits_type::find(_data() + pos, _size() - n - pos + 1, s[0]);
+            if (!p)
+                return npos;
+            pos = p - _data();
+            if (!traits_type::compare(p, s, n))
+                return pos;
+        }
+        return npos;
+    }
+    size_type find(const basic_string& str, size_type pos = 0) const { return find(str._data(), pos, str._size()); }
+    size_type find(const CharT *s, size_type pos = 0) const { return find(s, pos, traits_type::length(s)); }
+    size_type find(CharT c, size_type pos = 0) const {
+        if (pos >= _size())
+            return npos;
+        const CharT *p = traits_type::find(_data() + pos, _size() - pos, c);
+        return p ? p - _data() : npos;
+    }
+
+    size_type rfind(const CharT *s, size_type pos, size_type n) const {
+        if (n > _size())
+            return npos;
+        pos = std::min(pos, _size() - n);
+        do {
+            if (!traits_type::compare(_data() + pos, s, n))
+                return pos;
+        } while (pos-- > 0);
+        return npos;
+    }
+    size_type rfind(const basic_string& str, size_type pos = npos) const { return rfind(str._data(), pos, str._size()); }
+    size_type rfind(const CharT *s, size_type pos = npos) const { return rfind(s, pos, traits_type::length(s)); }
+    size_type rfind(CharT c, size_type pos = npos) const { return rfind(&c, pos, 1); }
+
+    size_type find_first_of(const CharT *s, size_type pos, size_type n) const {
+        for (; pos < _size(); ++pos)
+            if (traits_type::find(s, n, _data()[pos]))
+                return pos;
+        return npos;
+    }
+    size_type find_first_of(const basic_string& str, size_type pos = 0) const {
+        return find_first_of(str._data(), pos, str._size());
+    }
+    size_type find_first_of(const CharT *s, size_type pos = 0) const {
+        return find_first_of(s, pos, traits_type::length(s));
+    }
+    size_type find_first_of(CharT c, size_type pos = 0) const { return find(c, pos); }
+
+    size_type find_last_of(const CharT *s, size_type pos, size_type n) const {
+        if (!_size())
+            return npos;
+        pos = std::min(pos, _size() - 1);
+        do {
+            if (traits_type::find(s, n, _data()[pos]))
+                return pos;
+        } while (pos-- > 0);
+        return npos;
+    }
+    size_type find_last_of(const basic_string& str, size_type pos = npos) const {
+        return find_last_of(str._data(), pos, str._size());
+    }
+    size_type find_last_of(const CharT *s, size_type pos = npos) const {
+        return find_last_of(s, pos, traits_type::length(s));
+    }
+    size_type find_last_of(CharT c, size_type pos = npos) const { return rfind(c, pos); }
+
+    size_type find_first_not_of(const CharT *s, size_type pos, size_type n) const {
+        for (; pos < _size(); ++pos)
+            if (!traits_type::find(s, n, _data()[pos]))
+                return pos;
+        return npos;
+    }
+    size_type find_first_not_of(const basic_string& str, size_type pos = 0) const {
+        return find_first_not_of(str._data(), pos, str._size());
+    }
+    size_type find_first_not_of(const CharT *s, size_type pos = 0) const {
+        return find_first_not_of(s, pos, traits_type::length(s));
+    }
+    size_type find_first_not_of(CharT c, size_type pos = 0) const { return find_first_not_of(&c, pos, 1); }
+
+    size_type find_last_not_of(const CharT *s, size_type pos, size_type n) const {
+        if (!_size())
+            return npos;
+        pos = std::min(pos, _size() - 1);
+        do {
+            if (!traits_type::find(s, n, _data()[pos]))
+                return pos;
+        } while (pos-- > 0);
+        return npos;
+    }
+    size_type find_last_not_of(const basic_string& str, size_type pos = npos) const {
+        return find_last_not_of(str._data(), pos, str._size());
+    }
+    size_type find_last_not_of(const CharT *s, size_type pos = npos) const {
+        return find_last_not_of(s, pos, traits_type::length(s));
+    }
+    size_type find_last_not_of(CharT c, size_type pos = npos) const { return find_last_not_of(&c, pos, 1); }
+
+    basic_string substr(size_type pos = 0, size_type n = npos) const {
+        _check_pos(pos, "basic_string::substr");
+        return basic_string(_data() + pos, _limit(pos, n));
+    }
+
+    // ***** Comparisons *****
+
+    // the common characters with one compare, then the sizes
+    int compare(const CharT *s, size_type n) const {
+        int ret = traits_type::compare(_data(), s, std::min(_size(), n));
+        if (ret)
+            return ret;
+        return _size() < n ? -1 : _size() > n;
+    }
+    // Two short strings of chars: their first 8 characters compared at
+    // once, as big endian words (both buffers have 16 bytes to read)
+    int compare(const basic_string& str) const {
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+        if (sizeof(CharT) == 1 && _is_local() && str._is_local()
+            && _size() >= 8 && str._size() >= 8) {
+            unsigned long long a, b;
+            std::memcpy(&a, _local, 8);
+            std::memcpy(&b, str._local, 8);
+            if (a != b)
+                return __builtin_bswap64(a) < __builtin_bswap64(b) ? -1 : 1;
+        }
+#endif
+        return compare(str._data(), str._size());
+    }
+    int compare(const CharT *s) const { return compare(s, traits_type::length(s)); }
+    int compare(size_type pos, size_type n, const basic_string& str) const {
+        return substr(pos, n).compare(str);
+    }
+    int compare(size_type pos1, size_type n1, const basic_string& str, size_type pos2, size_type n2) const {
+        return substr(pos1, n1).compare(str.substr(pos2, n2));
+    }
+    int compare(size_type pos, size_type n, const CharT *s) const { return substr(pos, n).compare(s); }
+    int compare(size_type pos, size_type n1, const CharT *s, size_type n2) const {
+        return substr(pos, n1).compare(s, n2);
+    }
+};
+
+// for when npos is bound to a reference (std::min...)
+template <class C, class T, class A>
+const typename basic_string<C, T, A>::size_type basic_string<C, T, A>::npos;
+
+// Moved with a memcpy: nothing points into it
+template <class C, class T, class A>
+struct is_trivially_relocatable<basic_string<C, T, A> > :
+    public is_integral_base<true, basic_string<C, T, A> > {};
+
+typedef basic_string<char>      string;
+
+/*
+ * **************************************
+ * ********** Concatenation *************
+ * **************************************
+*/
+
+template <class C, class T, class A>
+basic_string<C, T, A> operator+(const basic_string<C, T, A>& lhs, const basic_string<C, T, A>& rhs) {
+    basic_string<C, T, A> ret;
+    ret.reserve(lhs.size() + rhs.size());
+    return ret.append(lhs).append(rhs);
+}
+
+template <class C, class T, class A>
+basic_string<C, T, A> operator+(const C *lhs, const basic_string<C, T, A>& rhs) {
+    return basic_string<C, T, A>(lhs) + rhs;
+}
+
+template <class C, class T, class A>
+basic_string<C, T, A> operator+(C lhs, const basic_string<C, T, A>& rhs) {
+    return basic_string<C, T, A>(1, lhs) + rhs;
+}
+
+template <class C, class T, class A>
+basic_string<C, T, A> operator+(const basic_string<C, T, A>& lhs, const C *rhs) {
+    basic_string<C, T, A> ret(lhs);
+    return ret.append(rhs);
+}
+
+template <class C, class T, class A>
+basic_string<C, T, A> operator+(const basic_string<C, T, A>& lhs, C rhs) {
+    basic_string<C, T, A> ret(lhs);
+    ret.push_back(rhs);
+    return ret;
+}
+
+/*
+ * **************************************
+ * ********** Relational Ope ************
+ * **************************************
+*/
+
+template <class C, class T, class A>
+bool operator==(const basic_string<C, T, A>& lhs, const basic_string<C, T, A>& rhs) {
+    return lhs.size() == rhs.size() && !T::compare(lhs.data(), rhs.data(), lhs.size());
+}
+template <class C, class T, class A>
+bool operator==(const C *lhs, const basic_string<C, T, A>& rhs) { return !rhs.compare(lhs); }
+template <class C, class T, class A>
+bool operator==(const basic_string<C, T, A>& lhs, const C *rhs) { return !lhs.compare(rhs); }
+
+template <class C, class T, class A>
+bool operator!=(const basic_string<C, T, A>& lhs, const basic_string<C, T, A>& rhs) { return !(lhs == rhs); }
+template <class C, class T, class A>
+bool operator!=(const C *lhs, const basic_string<C, T, A>& rhs) { return !(lhs == rhs); }
+template <class C, class T, class A>
+bool operator!=(const basic_string<C, T, A>& lhs, const C *rhs) { return !(lhs == rhs); }
+
+template <class C, class T, class A>
+bool operator<(const basic_string<C, T, A>& lhs, const basic_string<C, T, A>& rhs) { return lhs.compare(rhs) < 0; }
+template <class C, class T, class A>
+bool operator<(const C *lhs, const basic_string<C, T, A>& rhs) { return rhs.compare(lhs) > 0; }
+template <class C, class T, class A>
+bool operator<(const basic_string<C, T, A>& lhs, const C *rhs) { return lhs.compare(rhs) < 0; }
+
+template <class C, class T, class A>
+bool operator>(const basic_string<C, T, A>& lhs, const basic_string<C, T, A>& rhs) { return rhs < lhs; }
+template <class C, class T, class A>
+bool operator>(const C *lhs, const basic_string<C, T, A>& rhs) { return rhs < lhs; }
+template <class C, class T, class A>
+bool operator>(const basic_string<C, T, A>& lhs, const C *rhs) { return rhs < lhs; }
+
+template <class C, class T, class A>
+bool operator<=(const basic_string<C, T, A>& lhs, const basic_string<C, T, A>& rhs) { return !(rhs < lhs); }
+template <class C, class T, class A>
+bool operator<=(const C *lhs, const basic_string<C, T, A>& rhs) { return !(rhs < lhs); }
+template <class C, class T, class A>
+bool operator<=(const basic_string<C, T, A>& lhs, const C *rhs) { return !(rhs < lhs); }
+
+template <class C, class T, class A>
+bool operator>=(const basic_string<C, T, A>& lhs, const basic_string<C, T, A>& rhs) { return !(lhs < rhs); }
+template <class C, class T, class A>
+bool operator>=(const C *lhs, const basic_string<C, T, A>& rhs) { return !(lhs < rhs); }
+template <class C, class T, class A>
+bool operator>=(const basic_string<C, T, A>& lhs, const C *rhs) { return !(lhs < rhs); }
+
+template <class C, class T, class A>
+void swap(basic_string<C, T, A>& lhs, basic_string<C, T, A>& rhs) { lhs.swap(rhs); }
+
+/*
+ * **************************************
+ * *************** Streams **************
+ * **************************************
+*/
+
+template <class C, class T, class A>
+std::basic_ostream<C, T>& operator<<(std::basic_ostream<C, T>& os, const basic_string<C, T, A>& str) {
+    return os.write(str.data(), str.size());
+}
+
+// A word, the first whitespaces skipped
+template <class C, class T, class A>
+std::basic_istream<C, T>& operator>>(std::basic_istream<C, T>& is, basic_string<C, T, A>& str) {
+    std::basic_string<C, T> tmp;
+    if (is >> tmp)
+        str.assign(tmp.data(), tmp.size());
+    return is;
+}
+
+}
+
+#endif
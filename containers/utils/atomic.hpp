@@ -0,0 +1,102 @@
+#ifndef ATOMIC_HPP
+# define ATOMIC_HPP
+
+// ****** atomic helpers ******
+// C++98 has no <atomic>, these wrap the __atomic builtins
+// (gcc >= 4.7, clang) which work whatever the -std flag.
+// Only integral and pointer types fitting in a register can be used.
+
+# include <sched.h> // needed for sched_yield
+
+// size of a cache line, used to pad variables shared between threads
+# define FT_CACHELINE 64
+
+namespace ft
+{
+
+// Memory orders, same meaning as std::memory_order
+enum memory_order {
+    mo_relaxed = __ATOMIC_RELAXED,
+    mo_acquire = __ATOMIC_ACQUIRE,
+    mo_release = __ATOMIC_RELEASE,
+    mo_acq_rel = __ATOMIC_ACQ_REL,
+    mo_seq_cst = __ATOMIC_SEQ_CST
+};
+
+template <class T>
+inline T atomic_load(const volatile T *p, memory_order mo = mo_acquire) {
+    return __atomic_load_n(p, mo);
+}
+
+template <class T>
+inline void atomic_store(volatile T *p, T val, memory_order mo = mo_release) {
+    __atomic_store_n(p, val, mo);
+}
+
+template <class T>
+inline T atomic_exchange(volatile T *p, T val, memory_order mo = mo_acq_rel) {
+    return __atomic_exchange_n(p, val, mo);
+}
+
+// Order used when a compare and swap fails (no store happened)
+inline memory_order _cas_failure_order(memory_order mo) {
+    if (mo == mo_seq_cst)
+        return mo_seq_cst;
+    if (mo == mo_acquire || mo == mo_acq_rel)
+        return mo_acquire;
+    return mo_relaxed;
+}
+
+// On failure, expected is updated with the current value
+template <class T>
+inline bool atomic_cas(volatile T *p, T &expected, T desired,
+                       memory_order mo = mo_acq_rel) {
+    return __atomic_compare_exchange_n(p, &expected, desired, false, mo,
+                                       _cas_failure_order(mo));
+}
+
+// Returns the value before the addition
+template <class T>
+inline T atomic_fetch_add(volatile T *p, T val, memory_order mo = mo_acq_rel) {
+    return __atomic_fetch_add(p, val, mo);
+}
+
+template <class T>
+inline T atomic_fetch_sub(volatile T *p, T val, memory_order mo = mo_acq_rel) {
+    return __atomic_fetch_sub(p, val, mo);
+}
+
+inline void atomic_fence(memory_order mo = mo_seq_cst) {
+    __atomic_thread_fence(mo);
+}
+
+// To be called in spin loops, lets the other hyperthread run
+inline void cpu_relax() {
+# if defined(__x86_64__) || defined(__i386__)
+    __builtin_ia32_pause();
+# elif defined(__aarch64__)
+    __asm__ __volatile__("yield");
+# endif
+}
+
+// Waiting helper for spin loops: pauses a few times,
+// then yields the cpu so the thread we're waiting for can run
+class backoff {
+    unsigned int _spins;
+
+    public:
+    backoff(): _spins(0) {}
+
+    void operator()() {
+        if (_spins < 64) {
+            ++_spins;
+            cpu_relax();
+        }
+        else
+            sched_yield();
+    }
+};
+
+}
+
+#endif
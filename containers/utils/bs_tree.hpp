@@ -0,0 +1,556 @@
+#ifndef BS_TREE_HPP
+# define BS_TREE_HPP
+
+# include "comparisons.hpp"  // needed relational operators
+# include "pair.hpp"         // needed for ft::pair, ft::make_pair and ft::compressed_pair
+# include "iterators.hpp"    // needed for reverse iterator
+# include "tree_links.hpp"   // needed for iterator steps
+# include "tree_iterator.hpp" // iterator
+# include "tree_balance.hpp" // the balancing policies
+# include "rb_tree.hpp"      // needed for identity and select_first
+
+# include <memory>    // needed for std::allocator
+# include <limits>   // needed for max_size()
+
+namespace ft {
+
+/*
+ * Binary search tree balanced by a policy (see tree_balance.hpp),
+ * behind avl_map, treap_map and splay_map.
+ *
+ * Same elements, iterators and interface as rb_tree, without its
+ * extras (node handles, split/join, set operations...): keys are
+ * unique, and found with == as in rb_tree. The end() node is part of the
+ * container and the root hangs on its left, so the policies never
+ * see an empty parent. Nothing is recursive, a splay tree can be a
+ * single branch.
+*/
+template <
+    class Key,
+    class Value,
+    class KeyOfValue,
+    class Balance,
+    class Compare = std::less<Key>,
+    class Alloc = std::allocator<Value>
+> class bs_tree {
+    public:
+
+    /*
+     * **************************************
+     * ********** Member Types **************
+     * **************************************
+    */
+
+    typedef Key                     key_type;
+    typedef Value                   value_type;
+
+    typedef std::ptrdiff_t          difference_type;
+    typedef std::size_t             size_type;
+    typedef Alloc                   allocator_type;
+    typedef value_type&             reference;
+    typedef const value_type&       const_reference;
+
+    typedef typename Alloc::pointer       pointer;
+    typedef typename Alloc::const_pointer const_pointer;
+
+    typedef Compare                 key_compare;
+    typedef Balance                 balance_type;
+
+    // Class that compares 2 objects of value_type by their keys
+    class value_compare :
+    public std::binary_function<value_type, value_type, bool> {
+        friend class bs_tree;
+        protected:
+        Compare comp;
+        // constructed with the tree's comparison object
+        value_compare (Compare c) : comp(c) {}
+        public:
+        typedef bool result_type;
+        typedef value_type first_argument_type;
+        typedef value_type second_argument_type;
+        bool operator() (const value_type& x, const value_type& y) const {
+            return comp(KeyOfValue()(x), KeyOfValue()(y));
+        }
+    };
+
+protected:
+    // ***** private BST node_type *****
+    struct node_type : tree_links<node_type, threaded_nodes<Key>::value>,
+                       Balance::node_data {
+        typedef typename Balance::node_data balance_data;
+
+        value_type * val;
+        node_type  * l;
+        node_type  * r;
+        node_type  * p;
+
+        // end() node
+        node_type(): val(NULL), l(NULL), r(NULL), p(NULL) {}
+
+        node_type(const value_type & x, Alloc & al): val(al.allocate(1)),
+                                                     l(NULL),
+                                                     r(NULL),
+                                                     p(NULL)
+        { al.construct(val, x); }
+
+        node_type *parent() const { return p; }
+    };
+
+public:
+    typedef tree_iterator<value_type, node_type>              iterator;
+    typedef tree_iterator<const value_type, const node_type>  const_iterator;
+    typedef reverse_iterator<const_iterator>                  const_reverse_iterator;
+    typedef reverse_iterator<iterator>                        reverse_iterator;
+
+    /*
+     * **************************************
+     * ************ Variables ***************
+     * **************************************
+    */
+
+protected:
+    node_type            _end;      // end() node, the root is its left child
+    node_type *          _first;    // leftmost node, _end when empty
+    // comparator, allocator and size, an empty comparator or allocator takes no space
+    ft::compressed_pair<ft::compressed_pair<key_compare, allocator_type>, size_type>  _cmp_al_sz;
+
+    /*
+     * **************************************
+     * ********* Member Functions ***********
+     * **************************************
+    */
+private:
+    bool _cmp_k(const key_type& a, const key_type& b) const { return _cmp_al_sz.first().first()(a, b); }
+    allocator_type&       _alloc()       { return _cmp_al_sz.first().second(); }
+    const allocator_type& _alloc() const { return _cmp_al_sz.first().second(); }
+    size_type&            _sz()          { return _cmp_al_sz.second(); }
+    const size_type&      _sz()    const { return _cmp_al_sz.second(); }
+
+    static const key_type& _key(const node_type *n) { return KeyOfValue()(*n->val); }
+
+    // empty tree, the end() node is its own neighbour when threaded
+    void _reset_end(){
+        _end.l = NULL;
+        _first = &_end;
+        node_type::chain(&_end, &_end);
+    }
+
+public:
+
+    // ***** Constructors *****
+    //
+    // Default
+    explicit bs_tree (const key_compare& comp = key_compare(),
+                      const allocator_type& alloc = allocator_type()) :
+        _cmp_al_sz(ft::compressed_pair<key_compare, allocator_type>(comp, alloc), 0)
+    { _reset_end(); }
+
+    // Copy
+    bs_tree (const bs_tree & cpy):
+        _cmp_al_sz(cpy._cmp_al_sz.first(), 0)
+    { _reset_end(); _append(cpy.begin(), cpy.end()); }
+
+
+    // ***** Destructor *****
+    ~bs_tree() { _destroy(_end.l); }
+
+
+    // ***** Assignment operator *****
+    bs_tree& operator=(const bs_tree& other){
+        if (&other != this){
+            clear();
+            _append(other.begin(), other.end());
+        }
+        return *this;
+    }
+
+    // ***** Max_size *****
+private:
+    size_type _elem_size() const { return sizeof(node_type) - sizeof(value_type*) + sizeof(value_type); }
+public:
+    size_type max_size() const {
+        return std::numeric_limits<difference_type>::max() / (_elem_size() / 2 < 1 ? 1 : _elem_size() / 2 );
+    }
+
+    // ***** Get_allocator *****
+    allocator_type get_allocator() const {return _alloc();}
+
+private:
+    void _delete_node(node_type *n){
+        _alloc().destroy(n->val);
+        _alloc().deallocate(n->val, 1);
+        delete n;
+    }
+
+    // destroys the subtree of n, left children are rotated up
+    // until there is none: no recursion, whatever the height
+    void _destroy(node_type *n){
+        while (n){
+            if (n->l){
+                node_type *l = n->l;
+                n->l = l->r;
+                l->r = n;
+                n = l;
+            }
+            else {
+                node_type *r = n->r;
+                _delete_node(n);
+                n = r;
+            }
+        }
+    }
+
+    // [first, last) is sorted and goes after the last element,
+    // each one is linked on the right of the previous one
+    template< class InputIt >
+    void _append(InputIt first, InputIt last){
+        node_type *prev = _end.l ? node_type::prev(&_end) : &_end;
+        for (; first != last; ++first){
+            node_type *n = new node_type(*first, _alloc());
+            n->p = prev;
+            if (prev == &_end){
+                _end.l = n;
+                _first = n;
+            }
+            else
+                prev->r = n;
+            node_type::link_after(n, prev);
+            ++_sz();
+            Balance::inserted(n);
+            prev = n;
+        }
+    }
+
+    /*
+     * **************************************
+     * ************* Iterator ***************
+     * **************************************
+    */
+
+public:
+    iterator begin(){ return iterator(_first); }
+
+    const_iterator begin() const { return const_iterator(_first); }
+
+    iterator end(){ return iterator(&_end); }
+
+    const_iterator end() const { return const_iterator(&_end); }
+
+    reverse_iterator rbegin(){ return reverse_iterator(end()); }
+
+    const_reverse_iterator rbegin() const { return const_reverse_iterator(end()); }
+
+    reverse_iterator rend(){ return reverse_iterator(begin()); }
+
+    const_reverse_iterator rend() const { return const_reverse_iterator(begin()); }
+
+    /*
+     * **************************************
+     * ************* Capacity ***************
+     * **************************************
+    */
+
+    // ***** Empty *****
+    bool empty() const { return !_sz(); }
+
+    // ***** Size *****
+    size_type size() const { return _sz(); }
+
+    /*
+     * **************************************
+     * ************ Modifiers ***************
+     * **************************************
+    */
+
+    // ***** Clear *****
+    void clear(){
+        _destroy(_end.l);
+        _sz() = 0;
+        _reset_end();
+    }
+
+    // ***** Insert *****
+    // Insert elem
+    ft::pair<iterator, bool> insert(const value_type & x){
+        const key_type & k = KeyOfValue()(x);
+        node_type *parent = &_end;
+        node_type *n = _end.l;
+        bool left = true;
+
+        while (n){
+            if (k == _key(n)){
+                Balance::accessed(n);
+                return ft::make_pair(iterator(n), false);
+            }
+            parent = n;
+            left = _cmp_k(k, _key(n));
+            n = left ? n->l : n->r;
+        }
+        n = new node_type(x, _alloc());
+        n->p = parent;
+        if (left){
+            parent->l = n;
+            node_type::link_before(n, parent);
+            if (parent == _first)
+                _first = n;
+        }
+        else {
+            parent->r = n;
+            node_type::link_after(n, parent);
+        }
+        ++_sz();
+        Balance::inserted(n);
+        return ft::make_pair(iterator(n), true);
+    }
+
+    // Insert hint
+    iterator insert(iterator pos, const value_type & x){
+        (void)pos;
+        return insert(x).first;
+    }
+
+    // Insert range
+    template< class InputIt >
+    void insert( InputIt first, InputIt last ){
+        for (; first != last; ++first)
+            insert(*first);
+    }
+
+    // ***** erase *****
+    void erase(iterator pos){
+        node_type *n = pos.base();
+
+        if (n == _first)
+            _first = node_type::next(n);
+        node_type::unlink(n);
+        Balance::remove(n);
+        _delete_node(n);
+        --_sz();
+    }
+
+    size_type erase(const key_type & k){
+        iterator it = find(k);
+        if (it == end())
+            return 0;
+        erase(it);
+        return 1;
+    }
+
+    void erase(iterator first, iterator last){
+        while (first != last)
+            erase(first++);
+    }
+
+    // ***** swap *****
+    // the end() nodes stay in their container, they trade places
+    void swap(bs_tree& other){
+        if (&other == this)
+            return;
+        node_type tmp_end = _end;
+        _end = other._end;
+        other._end = tmp_end;
+        node_type *tmp_first = _first;
+        _first = other._first;
+        other._first = tmp_first;
+        ft::compressed_pair<ft::compressed_pair<key_compare, allocator_type>, size_type>
+            tmp = _cmp_al_sz;
+        _cmp_al_sz = other._cmp_al_sz;
+        other._cmp_al_sz = tmp;
+        _relink_end();
+        other._relink_end();
+    }
+
+private:
+    // the nodes next to end() are told where it is now
+    void _relink_end(){
+        if (!_end.l)
+            _reset_end();
+        else {
+            _end.l->p = &_end;
+            node_type::relink(&_end);
+        }
+    }
+
+    /*
+     * **************************************
+     * ************** Lookup ****************
+     * **************************************
+    */
+
+public:
+    // ***** count *****
+    size_type count(const key_type & k) const { return find(k) != end(); }
+
+    // ***** find *****
+    // The non const lookups tell the policy where their descent ended
+    // (splay), found or not: a miss pays for its path too
+    iterator       find(const key_type & k) {
+        node_type *last;
+        node_type *n = _find_node(k, last);
+        return _accessed(n, last);
+    }
+
+    const_iterator find(const key_type & k) const {
+        node_type *last;
+        node_type *n = _find_node(k, last);
+        return n ? const_iterator(n) : end();
+    }
+
+    // returns the first element that isn't less than k, or end() if none is found
+    iterator       lower_bound (const key_type& k){
+        node_type *last;
+        node_type *n = _lower_node(k, last);
+        return _accessed(n, last);
+    }
+
+    const_iterator lower_bound (const key_type& k) const {
+        node_type *last;
+        node_type *n = _lower_node(k, last);
+        return n ? const_iterator(n) : end();
+    }
+
+    // returns the first element that would go after k, or end() if none is found
+    iterator       upper_bound (const key_type& k){
+        node_type *last;
+        node_type *n = _upper_node(k, last);
+        return _accessed(n, last);
+    }
+
+    const_iterator upper_bound (const key_type& k) const {
+        node_type *last;
+        node_type *n = _upper_node(k, last);
+        return n ? const_iterator(n) : end();
+    }
+
+    // returns a pair made of the return values of lower and upper bound
+    ft::pair<const_iterator,const_iterator> equal_range (const key_type& k) const{
+        return ft::make_pair<const_iterator,const_iterator>(lower_bound(k), upper_bound(k));
+    }
+
+    ft::pair<iterator,iterator> equal_range (const key_type& k){
+        node_type *last;
+        node_type *lo = _lower_node(k, last);
+        iterator hi = upper_bound(k);
+        return ft::make_pair<iterator,iterator>(lo ? iterator(lo) : end(), hi);
+    }
+
+private:
+    // n is the result of a descent that ended at last
+    iterator _accessed(node_type *n, node_type *last){
+        if (last)
+            Balance::accessed(last);
+        return n ? iterator(n) : end();
+    }
+
+    // == then a select of the child: no branch to mispredict on the way down
+    node_type * _find_node(const key_type & k, node_type *&last) const {
+        node_type *n = _end.l;
+        last = NULL;
+        while (n){
+            last = n;
+            if (k == _key(n))
+                return n;
+            n = _cmp_k(k, _key(n)) ? n->l : n->r;
+        }
+        return NULL;
+    }
+
+    // descents for the bounds, NULL if it's end()
+    node_type * _lower_node(const key_type& k, node_type *&last) const {
+        node_type *ret = NULL;
+        node_type *n = _end.l;
+        last = NULL;
+        while (n){
+            last = n;
+            if (_cmp_k(_key(n), k))
+                n = n->r;
+            else {
+                ret = n;
+                n = n->l;
+            }
+        }
+        return ret;
+    }
+
+    node_type * _upper_node(const key_type& k, node_type *&last) const {
+        node_type *ret = NULL;
+        node_type *n = _end.l;
+        last = NULL;
+        while (n){
+            last = n;
+            if (_cmp_k(k, _key(n))){
+                ret = n;
+                n = n->l;
+            }
+            else
+                n = n->r;
+        }
+        return ret;
+    }
+
+public:
+    /*
+     * **************************************
+     * ************ Observers ***************
+     * **************************************
+    */
+
+    key_compare   key_comp()   const { return _cmp_al_sz.first().first(); }
+    value_compare value_comp() const { return value_compare(_cmp_al_sz.first().first()); }
+
+};  // --------- End of bs_tree
+
+
+    /*
+     * **************************************
+     * ** Non member - Relational operator **
+     * **************************************
+    */
+
+template< class K, class V, class KoV, class B, class C, class A >
+bool operator==( const ft::bs_tree<K,V,KoV,B,C,A>& lhs,
+                 const ft::bs_tree<K,V,KoV,B,C,A>& rhs ){
+    if (lhs.size() != rhs.size())
+        return false;
+    typename ft::bs_tree<K,V,KoV,B,C,A>::const_iterator lit = lhs.begin();
+    typename ft::bs_tree<K,V,KoV,B,C,A>::const_iterator rit = rhs.begin();
+    while (lit != lhs.end())
+        if (*lit++ != *rit++)
+            return false;
+    return true;
+}
+
+template< class K, class V, class KoV, class B, class C, class A >
+bool operator!=( const ft::bs_tree<K,V,KoV,B,C,A>& lhs,
+                 const ft::bs_tree<K,V,KoV,B,C,A>& rhs ){
+    return !(lhs == rhs);
+}
+
+template< class K, class V, class KoV, class B, class C, class A >
+bool operator<( const ft::bs_tree<K,V,KoV,B,C,A>& lhs,
+                const ft::bs_tree<K,V,KoV,B,C,A>& rhs ){
+    return ft::lexicographical_compare(lhs.begin(), lhs.end(),
+                                        rhs.begin(), rhs.end());
+}
+
+template< class K, class V, class KoV, class B, class C, class A >
+bool operator>(const ft::bs_tree<K,V,KoV,B,C,A>& lhs,
+               const ft::bs_tree<K,V,KoV,B,C,A>& rhs) {
+    return rhs < lhs;
+}
+
+template< class K, class V, class KoV, class B, class C, class A >
+bool operator<=(const ft::bs_tree<K,V,KoV,B,C,A>& lhs,
+                const ft::bs_tree<K,V,KoV,B,C,A>& rhs) {
+    return !(rhs < lhs);
+}
+
+template< class K, class V, class KoV, class B, class C, class A >
+bool operator>=(const ft::bs_tree<K,V,KoV,B,C,A>& lhs,
+                const ft::bs_tree<K,V,KoV,B,C,A>& rhs) {
+    return !(lhs < rhs);
+}
+
+} // --------- End of ft namespace
+
+#endif
@@ -0,0 +1,211 @@
+#ifndef EPOCH_HPP
+# define EPOCH_HPP
+
+# include <cstddef>     // needed for size_t
+# include <pthread.h>   // needed for the thread exit hook
+
+// atomic builtins wrappers
+# include "atomic.hpp"
+
+namespace ft
+{
+
+/*
+ * Epoch based memory reclamation
+ *
+ * Lock-free readers may still be reading a node another thread has just
+ * unlinked, so the node can't be freed right away: it is retired instead.
+ * Threads announce the global epoch when they start reading (epoch_guard)
+ * and the global epoch only moves forward once every reading thread has
+ * announced the current one. A node retired during epoch e can't be seen
+ * by anyone once the global epoch reaches e + 2, it is then reclaimed.
+ *
+ * One domain is shared by every container of the process, each thread
+ * gets a record on first use, given back when the thread exits.
+*/
+
+// Header of objects that can be retired,
+// reclaim is called once no reader can see the object anymore
+struct epoch_node {
+    epoch_node  *retired_next;
+    void        (*reclaim)(epoch_node *);
+};
+
+// Per thread state, records are never freed but can be reused
+struct epoch_record {
+    volatile unsigned long  state;      // (epoch << 1) | reading
+    unsigned int            depth;      // nested guards, owner only
+    volatile int            owned;      // a live thread uses this record
+    epoch_record            *next;      // next record, set once
+    epoch_node              *limbo[3];  // retired nodes, by epoch % 3
+    unsigned long           limbo_epoch[3];
+    std::size_t             retired;
+    char                    pad[FT_CACHELINE];
+};
+
+struct epoch_globals {
+    volatile unsigned long  epoch;
+    char                    pad[FT_CACHELINE];
+    epoch_record * volatile records;
+    pthread_key_t           key;
+    pthread_once_t          once;
+};
+
+// Number of retires between two attempts to move the epoch forward
+# define EPOCH_RETIRE_BATCH 64
+
+class epoch {
+
+    /*
+     * **************************************
+     * ************* Globals ****************
+     * **************************************
+    */
+
+    static epoch_globals &_globals() {
+        static epoch_globals g = { 2, {0}, NULL, pthread_key_t(), PTHREAD_ONCE_INIT };
+        return g;
+    }
+
+    static epoch_record *&_local() {
+        static __thread epoch_record *rec = NULL;
+        return rec;
+    }
+
+    /*
+     * **************************************
+     * *********** Thread records ***********
+     * **************************************
+    */
+
+    // Called when a thread exits, its retired nodes stay in the record
+    // until another thread takes it
+    static void _release_record(void *p) {
+        epoch_record *rec = static_cast<epoch_record *>(p);
+        _try_advance();
+        _collect(rec);
+        atomic_store(&rec->owned, 0);
+    }
+
+    static void _make_key() {
+        pthread_key_create(&_globals().key, _release_record);
+    }
+
+    // Takes a free record, or creates one
+    static epoch_record *_acquire_record() {
+        epoch_globals &g = _globals();
+        pthread_once(&g.once, _make_key);
+        for (epoch_record *rec = atomic_load(&g.records); rec; rec = rec->next) {
+            int expected = 0;
+            if (!atomic_load(&rec->owned, mo_relaxed)
+                && atomic_cas(&rec->owned, expected, 1))
+                return _bind(rec);
+        }
+        epoch_record *rec = new epoch_record();
+        rec->owned = 1;
+        epoch_record *head = atomic_load(&g.records);
+        do {
+            rec->next = head;
+        } while (!atomic_cas(&g.records, head, rec));
+        return _bind(rec);
+    }
+
+    static epoch_record *_bind(epoch_record *rec) {
+        pthread_setspecific(_globals().key, rec);
+        _local() = rec;
+        return rec;
+    }
+
+    static epoch_record *_record() {
+        epoch_record *rec = _local();
+        return rec ? rec : _acquire_record();
+    }
+
+    /*
+     * **************************************
+     * ************ Reclamation *************
+     * **************************************
+    */
+
+    // The epoch moves forward if every reading thread is in it
+    static bool _try_advance() {
+        epoch_globals &g = _globals();
+        unsigned long e = atomic_load(&g.epoch, mo_seq_cst);
+        for (epoch_record *rec = atomic_load(&g.records); rec; rec = rec->next) {
+            unsigned long s = atomic_load(&rec->state, mo_seq_cst);
+            if ((s & 1) && (s >> 1) != e)
+                return false;
+        }
+        return atomic_cas(&g.epoch, e, e + 1, mo_seq_cst);
+    }
+
+    static void _free_bucket(epoch_record *rec, int i) {
+        epoch_node *n = rec->limbo[i];
+        rec->limbo[i] = NULL;
+        while (n) {
+            epoch_node *next = n->retired_next;
+            n->reclaim(n);
+            n = next;
+        }
+    }
+
+    // Reclaims the buckets nobody can see anymore
+    static void _collect(epoch_record *rec) {
+        unsigned long e = atomic_load(&_globals().epoch, mo_seq_cst);
+        for (int i = 0; i < 3; i++)
+            if (rec->limbo[i] && rec->limbo_epoch[i] + 2 <= e)
+                _free_bucket(rec, i);
+    }
+
+public:
+
+    // Start of a read section, may be nested
+    static void enter() {
+        epoch_record *rec = _record();
+        if (rec->depth++)
+            return;
+        unsigned long e = atomic_load(&_globals().epoch, mo_relaxed);
+        atomic_store(&rec->state, (e << 1) | 1, mo_relaxed);
+        atomic_fence(mo_seq_cst);
+    }
+
+    // End of a read section
+    static void exit() {
+        epoch_record *rec = _local();
+        if (!--rec->depth)
+            atomic_store(&rec->state, 0UL, mo_release);
+    }
+
+    // n is unlinked, it will be reclaimed once no reader can see it
+    static void retire(epoch_node *n) {
+        epoch_record *rec = _record();
+        unsigned long e = atomic_load(&_globals().epoch, mo_seq_cst);
+        int           i = e % 3;
+
+        // the bucket holds nodes from epoch e - 3 or before
+        if (rec->limbo_epoch[i] != e) {
+            _free_bucket(rec, i);
+            rec->limbo_epoch[i] = e;
+        }
+        n->retired_next = rec->limbo[i];
+        rec->limbo[i] = n;
+        if (++rec->retired % EPOCH_RETIRE_BATCH == 0) {
+            _try_advance();
+            _collect(rec);
+        }
+    }
+};
+
+// Read section for the lifetime of the object
+class epoch_guard {
+    epoch_guard(const epoch_guard &);
+    epoch_guard& operator=(const epoch_guard &);
+
+    public:
+    epoch_guard() { epoch::enter(); }
+    ~epoch_guard() { epoch::exit(); }
+};
+
+}
+
+#endif
@@ -0,0 +1,59 @@
+#ifndef FORK_JOIN_HPP
+# define FORK_JOIN_HPP
+
+# include <pthread.h>   // needed for threads
+# include <unistd.h>    // needed for sysconf
+
+namespace ft
+{
+
+/*
+ * Fork-join helpers for the parallel tree algorithms (split/join based
+ * set operations of map and set). A recursive call forks its left half
+ * to a new thread while the current one works on the right half, until
+ * the thread budget is spent: log2(threads) levels of forks, so at most
+ * threads run at once and no queue is needed between them.
+ *
+ * Tasks are objects with an operator()() that mustn't throw.
+*/
+
+// Number of threads to use when the caller asks for 0
+inline unsigned hardware_threads() {
+    long n = sysconf(_SC_NPROCESSORS_ONLN);
+    return n > 0 ? static_cast<unsigned>(n) : 1;
+}
+
+// Levels of recursion that fork, for a number of threads
+inline int fork_depth(unsigned threads) {
+    int depth = 0;
+    if (!threads)
+        threads = hardware_threads();
+    while ((1u << depth) < threads)
+        ++depth;
+    return depth;
+}
+
+template <class Task>
+void *_fork_join_run(void *task) {
+    (*static_cast<Task *>(task))();
+    return NULL;
+}
+
+// Runs a and b, a in another thread if fork is set.
+// If the thread can't be created, a runs after b in this one.
+template <class Task>
+void fork_join(Task &a, Task &b, bool fork) {
+    pthread_t th;
+
+    if (fork && !pthread_create(&th, NULL, _fork_join_run<Task>, &a)) {
+        b();
+        pthread_join(th, NULL);
+        return;
+    }
+    b();
+    a();
+}
+
+}
+
+#endif
@@ -0,0 +1,39 @@
+#ifndef INT_KEY_HPP
+# define INT_KEY_HPP
+
+# include <limits>  // needed for is_signed
+
+namespace ft
+{
+
+/*
+ * Integer keys as unsigned numbers in the same order (int_map,
+ * int_set): the sign bit is flipped, negative keys go first. Only the
+ * sizeof(Key) low bytes are used.
+*/
+template <class Key>
+struct int_key {
+    typedef unsigned long long  bits_type;
+
+    enum { bytes = sizeof(Key) };
+
+    static bits_type to_bits(const Key &k) {
+        bits_type b = static_cast<bits_type>(k);
+        if (bytes < sizeof(bits_type))
+            b &= (static_cast<bits_type>(1) << (8 * bytes % 64)) - 1;
+        return b ^ _sign();
+    }
+
+    static Key from_bits(bits_type b) { return static_cast<Key>(b ^ _sign()); }
+
+private:
+    static bits_type _sign() {
+        if (!std::numeric_limits<Key>::is_signed)
+            return 0;
+        return static_cast<bits_type>(1) << (8 * bytes - 1);
+    }
+};
+
+}
+
+#endif
@@ -38,11 +38,12 @@ public:
     reverse_iterator(const reverse_iterator<U>& other): _base(other.base()) {}
 
     // Member access operators
-    value_type& operator*() const {
+    // reference, not value_type&: a proxy for vector<bool>
+    reference operator*() const {
         iterator_type ret(_base);
         return *(--ret); // <== returns the content of prev
     }
-    value_type& operator [] (difference_type n) const {
+    reference operator [] (difference_type n) const {
         return _base[-n - 1];
     }
     pointer operator -> () const {
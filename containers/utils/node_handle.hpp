@@ -0,0 +1,110 @@
+#ifndef NODE_HANDLE_HPP
+# define NODE_HANDLE_HPP
+
+# include <cstddef> // needed for NULL
+
+namespace ft
+{
+
+template <class Key, class Value, class KeyOfValue, class Compare, class Alloc, class Augment, bool Unique>
+class rb_tree;
+
+/*
+ * Node taken out of a map or a set by extract(), with its value.
+ * It can be given to insert() of another container of the same type,
+ * which links it as is: nothing is allocated nor copied.
+ * If the handle still owns the node when destroyed, the value is
+ * destroyed and the node freed.
+ *
+ * Key and Mapped are only used by map handles (key() and mapped()).
+ *
+ * C++98 has no move semantics, so like std::auto_ptr copying a handle
+ * transfers the node: the source is left empty.
+*/
+template <
+    class Node,
+    class Alloc,
+    class Key = typename Alloc::value_type,
+    class Mapped = Key
+> class node_handle {
+    template <class K, class V, class KoV, class C, class A, class Aug, bool U> friend class rb_tree;
+
+    public:
+    typedef Alloc                               allocator_type;
+    typedef typename Alloc::value_type          value_type;
+
+    private:
+    mutable Node *  _ptr;   // NULL if empty
+    allocator_type  _al;
+
+    node_handle(Node *n, const allocator_type &al): _ptr(n), _al(al) {}
+
+    // gives the node back to a container
+    Node *_release() const {
+        Node *n = _ptr;
+        _ptr = NULL;
+        return n;
+    }
+
+    void _destroy() {
+        if (!_ptr)
+            return;
+        _al.destroy(_ptr->val);
+        _al.deallocate(_ptr->val, 1);
+        delete _ptr;
+        _ptr = NULL;
+    }
+
+    public:
+    // Constructors
+    node_handle(): _ptr(NULL), _al() {}
+    node_handle(const node_handle &other): _ptr(other._release()), _al(other._al) {}
+
+    // Assignment operator, frees the node held before
+    node_handle& operator=(const node_handle &other) {
+        if (this != &other) {
+            _destroy();
+            _al = other._al;
+            _ptr = other._release();
+        }
+        return *this;
+    }
+
+    // Destructor
+    ~node_handle() { _destroy(); }
+
+    bool empty() const { return !_ptr; }
+
+    allocator_type get_allocator() const { return _al; }
+
+    // set only
+    value_type& value() const { return *_ptr->val; }
+
+    // map only, the key can be changed before inserting the node again
+    Key& key() const { return const_cast<Key&>(_ptr->val->first); }
+
+    Mapped& mapped() const { return _ptr->val->second; }
+
+    void swap(node_handle &other) {
+        Node            *tmp_ptr = other._ptr;
+        allocator_type  tmp_al = other._al;
+
+        other._ptr = _ptr;
+        other._al = _al;
+        _ptr = tmp_ptr;
+        _al = tmp_al;
+    }
+};
+
+// Result of inserting a node handle: if the key was already there,
+// node still holds the node and position is the element in the way
+template <class Iterator, class NodeHandle>
+struct insert_return_type {
+    Iterator    position;
+    bool        inserted;
+    NodeHandle  node;
+};
+
+}
+
+#endif
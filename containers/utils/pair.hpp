@@ -1,6 +1,8 @@
 #ifndef PAIR_HPP
 # define PAIR_HPP
 
+# include "type_traits.hpp"
+
 namespace ft {
 
 /*
@@ -107,6 +109,73 @@ bool operator>=( const ft::pair<T1,T2>& lhs, const ft::pair<T1,T2>& rhs ){
 // --------------------------------------------
 
 
+
+/*
+ * **************************************
+ * ******** ft::compressed_pair *********
+ * **************************************
+ *
+ * A pair for the bookkeeping members of the containers (comparator,
+ * allocator...). An empty member is a private base instead of a field,
+ * so it takes no space at all: a map<int, set<int> > doesn't pay a word
+ * for each std::less and std::allocator of its sets.
+ *
+ * The members are reached through first() and second().
+*/
+
+// One of the members, Idx tells the two apart when T1 and T2 are the same
+template < class T, int Idx, bool Empty = is_empty<T>::value >
+class compressed_pair_elem {
+    T   _val;
+
+public:
+    compressed_pair_elem() : _val() {}
+    compressed_pair_elem( const T& val ) : _val(val) {}
+
+    T&       get()       { return _val; }
+    const T& get() const { return _val; }
+};
+
+template < class T, int Idx >
+class compressed_pair_elem<T, Idx, true> : private T {
+public:
+    compressed_pair_elem() : T() {}
+    compressed_pair_elem( const T& val ) : T(val) {}
+
+    T&       get()       { return *this; }
+    const T& get() const { return *this; }
+};
+
+template<
+    class T1,
+    class T2
+> class compressed_pair :
+    private compressed_pair_elem<T1, 0>,
+    private compressed_pair_elem<T2, 1> {
+
+    typedef compressed_pair_elem<T1, 0>    first_base;
+    typedef compressed_pair_elem<T2, 1>    second_base;
+
+public:
+
+    typedef T1   first_type;
+    typedef T2   second_type;
+
+    compressed_pair() : first_base(), second_base() {}
+
+    compressed_pair( const T1& x, const T2& y ) : first_base(x), second_base(y) {}
+
+    T1&       first()        { return first_base::get(); }
+    const T1& first()  const { return first_base::get(); }
+
+    T2&       second()       { return second_base::get(); }
+    const T2& second() const { return second_base::get(); }
+
+};
+// --------------------------------------------
+//          End of ft::compressed_pair
+// --------------------------------------------
+
 /*
  * **************************************
  * ********* ft::make_pair **************
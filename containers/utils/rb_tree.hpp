@@ -0,0 +1,1949 @@
+#ifndef RB_TREE_HPP
+# define RB_TREE_HPP
+
+# include "comparisons.hpp"  // needed relational operators
+# include "pair.hpp"         // needed for ft::pair, ft::make_pair and ft::compressed_pair
+# include "iterators.hpp"    // needed for reverse iterator
+# include "node_handle.hpp"  // needed for extract()
+# include "sorted_merge.hpp" // needed for set algebra
+# include "fork_join.hpp"    // needed for parallel set operations
+# include "tree_links.hpp"   // needed for iterator steps
+# include "tree_iterator.hpp" // iterator
+
+# include <memory>    // needed for std::allocator
+# include <limits>   // needed for max_size()
+# include <algorithm> // needed for stable_sort()
+
+namespace ft {
+
+/*
+ * Red/black tree behind map and set (and any ordered container to come).
+ * Elements are Value, ordered by the Key that KeyOfValue gives for them.
+ * With Unique, a Value whose key is already there isn't inserted.
+ * Otherwise (multimap, multiset) equal keys are kept in insertion
+ * order, a new one goes after them.
+ *
+ * The containers derive from it and only add what is their own:
+ * constructors, value_compare, operator[]...
+*/
+
+// ***** KeyOfValue *****
+// mapped_type is what node handles give with mapped()
+
+// set: the value is the key
+template <class T>
+struct identity {
+    typedef T   mapped_type;
+
+    const T& operator()(const T& x) const { return x; }
+};
+
+// map: the key is the first member of the pair
+template <class Pair>
+struct select_first {
+    typedef typename Pair::second_type  mapped_type;
+
+    const typename Pair::first_type& operator()(const Pair& x) const { return x.first; }
+};
+
+// ***** Augment *****
+// Node augmentation policy: Augment is a base of every node, where it
+// can keep data about the subtree of the node (its size, the highest
+// end of its intervals...). The tree calls Augment::update(n) whenever
+// the subtree of n changes (insertion, erasure, rotations, joins),
+// children first, so n's data is computed from the value of n and the
+// data of its children. Children may be NULL, and the end() nodes are
+// updated too: their val is NULL, they only gather their children.
+//
+// The default one keeps nothing, and takes no space in the nodes.
+struct rb_no_augment {
+    static const bool enabled = false;
+
+    template <class Node>
+    static void update(Node *) {}
+};
+
+// Keeps the number of values in each subtree: the multi trees count
+// the elements of a key in two descents, O(log n), not by walking them.
+struct rb_subtree_size {
+    static const bool enabled = true;
+
+    size_t  subtree_size;
+
+    rb_subtree_size(): subtree_size(0) {}
+
+    template <class Node>
+    static void update(Node *n) {
+        n->subtree_size = (n->val ? 1 : 0) + (n->l ? n->l->subtree_size : 0)
+                                           + (n->r ? n->r->subtree_size : 0);
+    }
+};
+
+template <
+    class Key,
+    class Value,
+    class KeyOfValue,
+    class Compare = std::less<Key>,
+    class Alloc = std::allocator<Value>,
+    class Augment = rb_no_augment,
+    bool Unique = true
+> class rb_tree {
+    public:
+
+    /*
+     * **************************************
+     * ********** Member Types **************
+     * **************************************
+    */
+
+    typedef Key                     key_type;
+    typedef Value                   value_type;
+
+    typedef std::ptrdiff_t          difference_type;
+    typedef std::size_t             size_type;
+    typedef Alloc                   allocator_type;
+    typedef value_type&             reference;
+    typedef const value_type&       const_reference;
+
+    typedef typename Alloc::pointer       pointer;
+    typedef typename Alloc::const_pointer const_pointer;
+
+    typedef Compare                 key_compare;
+
+    // Class that compares 2 objects of value_type by their keys
+    class value_compare :
+    public std::binary_function<value_type, value_type, bool> {
+        friend class rb_tree;
+        protected:
+        Compare comp;
+        // constructed with the tree's comparison object
+        value_compare (Compare c) : comp(c) {}
+        public:
+        typedef bool result_type;
+        typedef value_type first_argument_type;
+        typedef value_type second_argument_type;
+        bool operator() (const value_type& x, const value_type& y) const {
+            return comp(KeyOfValue()(x), KeyOfValue()(y));
+        }
+    };
+
+protected:
+    // ***** private BST node_type *****
+    typedef enum {red, black} color_type;
+    struct node_type : tree_links<node_type, threaded_nodes<Key>::value>, Augment {
+        value_type * val;
+        node_type  * l;
+        node_type  * r;
+    private:
+        // parent address, the color is in the low bit (nodes are at
+        // least 2 bytes aligned): 8 bytes less per node
+        std::size_t  _parent_color;
+
+    public:
+        // default constructor used for end() nodes, color set to black
+        node_type(): val(NULL),
+                     l(NULL),
+                     r(NULL),
+                     _parent_color(black) {}
+
+        // value constructor, color set to red
+        node_type(const value_type & x, Alloc & al): val(al.allocate(1)),
+                                                     l(NULL),
+                                                     r(NULL),
+                                                     _parent_color(red)
+        { al.construct(val, x); }
+
+        node_type *parent() const {
+            return reinterpret_cast<node_type *>(_parent_color & ~static_cast<std::size_t>(1));
+        }
+
+        color_type color() const { return static_cast<color_type>(_parent_color & 1); }
+
+        void set_parent(node_type *p){
+            _parent_color = reinterpret_cast<std::size_t>(p) | (_parent_color & 1);
+        }
+
+        void set_color(color_type c){
+            _parent_color = (_parent_color & ~static_cast<std::size_t>(1)) | c;
+        }
+
+        node_type *sibling(){
+            if (parent()) {
+                if (isOnLeft())
+                    return parent()->r;
+                else
+                    return parent()->l;
+            }
+            return NULL;
+        }
+
+        bool isOnLeft() { return this == parent()->l; }
+
+        bool hasRedChild() {
+            return (l != NULL && l->color() == red) ||
+                   (r != NULL && r->color() == red);
+        }
+
+        ~node_type(){}
+    };
+
+public:
+    typedef tree_iterator<value_type, node_type>              iterator;
+    typedef tree_iterator<const value_type, const node_type>  const_iterator;
+    typedef reverse_iterator<const_iterator>                  const_reverse_iterator;
+    typedef reverse_iterator<iterator>                        reverse_iterator;
+
+    typedef ft::node_handle<node_type, Alloc, Key,
+                            typename KeyOfValue::mapped_type>  node_handle_type;
+    typedef ft::insert_return_type<iterator, node_handle_type>  insert_return_type;
+
+    /*
+     * **************************************
+     * ************ Variables ***************
+     * **************************************
+    */
+
+protected:
+    node_type *          _root;
+    // comparator, allocator and size, an empty comparator or allocator takes no space
+    ft::compressed_pair<ft::compressed_pair<key_compare, allocator_type>, size_type>  _cmp_al_sz;
+    node_type            _ends[2];  // end() nodes, first and last of the tree
+
+    /*
+     * **************************************
+     * ********* Member Functions ***********
+     * **************************************
+    */
+private:
+    // The comparator, the allocator and the size
+    bool _cmp_k(const key_type& a, const key_type& b) const { return _cmp_al_sz.first().first()(a, b); }
+    bool _cmp(const value_type& a, const value_type& b) const { return _cmp_k(_key_of(a), _key_of(b)); }
+    allocator_type&       _alloc()       { return _cmp_al_sz.first().second(); }
+    const allocator_type& _alloc() const { return _cmp_al_sz.first().second(); }
+    size_type&            _sz()          { return _cmp_al_sz.second(); }
+    const size_type&      _sz()    const { return _cmp_al_sz.second(); }
+
+    // The end() nodes are part of the container: an empty one,
+    // cleared or not, doesn't use the heap
+    void _insert_ends(){
+        _ends[0] = node_type();
+        _ends[1] = node_type();
+        _root = &_ends[0];
+        _root->r = &_ends[1];
+        _root->r->set_parent(_root);
+        node_type::chain(_root, _root->r);
+        _augment(_root->r);
+        _augment(_root);
+    }
+
+    // puts the end() node from at the place of to, in the tree of root
+    static void _move_end(node_type *from, node_type *to, node_type *&root){
+        *to = *from;
+        node_type *p = to->parent();
+        if (!p)
+            root = to;
+        else if (p->l == from)
+            p->l = to;
+        else
+            p->r = to;
+        if (to->l)
+            to->l->set_parent(to);
+        if (to->r)
+            to->r->set_parent(to);
+        node_type::relink(to);
+    }
+
+    // ***** augmentation *****
+    // see rb_no_augment, nothing is done when Augment isn't enabled
+    static void _augment(node_type *n){
+        if (Augment::enabled)
+            Augment::update(n);
+    }
+
+    // n and all its parents
+    static void _augment_up(node_type *n){
+        if (!Augment::enabled)
+            return;
+        for (; n; n = n->parent())
+            Augment::update(n);
+    }
+
+public:
+
+    // ***** Constructors *****
+    //
+    // Default
+    explicit rb_tree (const key_compare& comp = key_compare(),
+                      const allocator_type& alloc = allocator_type()) :
+        _root(NULL),
+        _cmp_al_sz(ft::compressed_pair<key_compare, allocator_type>(comp, alloc), 0)
+    { _insert_ends(); }
+
+    // Copy
+    rb_tree (const rb_tree & cpy):
+        _root(NULL),
+        _cmp_al_sz(cpy._cmp_al_sz.first(), 0)
+    { _insert_ends(); insert(cpy.begin(), cpy.end()); }
+
+
+    // ***** Destructor *****
+    ~rb_tree() { destroy_rec(_root); }
+
+
+    // ***** Assignment operator *****
+    rb_tree& operator=(const rb_tree& other){
+        clear();
+        insert(other.begin(), other.end());
+        return *this;
+    }
+
+    // ***** Max_size *****
+private:
+    size_type _elem_size() const { return sizeof(node_type) - sizeof(value_type*) + sizeof(value_type); }
+public:
+    size_type max_size() const {
+        return std::numeric_limits<difference_type>::max() / (_elem_size() / 2 < 1 ? 1 : _elem_size() / 2 );
+    }
+
+    // ***** Get_allocator *****
+    allocator_type get_allocator() const {return _alloc();}
+
+private:
+    // recursive function to destroy a node
+    // and all it's children
+    void destroy_rec(node_type *n){
+        if (n){
+            destroy_rec(n->l);
+            destroy_rec(n->r);
+            if (n->val){    // end() nodes aren't allocated
+                _alloc().destroy(n->val);
+                _alloc().deallocate(n->val, 1);
+                delete n;
+            }
+        }
+    }
+
+    /*
+     * **************************************
+     * ************* Iterator ***************
+     * **************************************
+    */
+
+public:
+    // the first element comes right after the first end() node
+    iterator begin(){
+        return iterator(node_type::next(&_ends[0]));
+    }
+
+    const_iterator begin() const {
+        return const_iterator(node_type::next(&_ends[0]));
+    }
+
+    iterator end(){
+        return iterator(&_ends[1]);
+    }
+
+    const_iterator end() const {
+        return const_iterator(&_ends[1]);
+    }
+
+    reverse_iterator rbegin(){ return reverse_iterator(end()); }
+
+    const_reverse_iterator rbegin() const { return const_reverse_iterator(end()); }
+
+    reverse_iterator rend(){ return reverse_iterator(begin()); }
+
+    const_reverse_iterator rend() const { return const_reverse_iterator(begin()); }
+
+
+
+    /*
+     * **************************************
+     * ************* Capacity ***************
+     * **************************************
+    */
+
+public:
+    // ***** Empty *****
+    bool empty() const { return !_sz() ? true : false; }
+
+    // ***** Size *****
+    size_type size() const { return _sz(); }
+
+private:
+    unsigned int size_rec(node_type * n) const {
+        if (n == NULL)
+            return 0;
+        else
+            return (size_rec(n->l) + size_rec(n->r) + 1);
+    }
+
+public:
+    /*
+     * **************************************
+     * ************ Modifiers ***************
+     * **************************************
+    */
+
+    // ***** Clear *****
+    void clear(){
+        destroy_rec(_root);
+        _sz() = 0;
+        _insert_ends();
+    }
+
+    // ***** Insert *****
+    //
+private:
+    // Rotations are used by insert and erase black/red fixes
+    // Rotate left
+    void _l_rotate(node_type* x) {
+        node_type* y = x->r;
+        x->r = y->l;
+        if (y->l != NULL) {
+            y->l->set_parent(x);
+        }
+        y->set_parent(x->parent());
+        if (x->parent() == NULL) {
+            _root = y;
+        } else if (x == x->parent()->l) {
+            x->parent()->l = y;
+        } else {
+            x->parent()->r = y;
+        }
+        y->l = x;
+        x->set_parent(y);
+        _augment(x);
+        _augment(y);
+    }
+
+    // Rotate right
+    void _r_rotate(node_type* x) {
+        node_type* y = x->l;
+        x->l = y->r;
+        if (y->r != NULL) {
+            y->r->set_parent(x);
+        }
+        y->set_parent(x->parent());
+        if (x->parent() == NULL) {
+            _root = y;
+        } else if (x == x->parent()->r) {
+            x->parent()->r = y;
+        } else {
+            x->parent()->l = y;
+        }
+        y->r = x;
+        x->set_parent(y);
+        _augment(x);
+        _augment(y);
+    }
+
+    // For balancing the tree after insertion
+    void _insert_fix(node_type* k) {
+        node_type*  u;
+        while (k->parent() && k->parent()->color() == red) {
+            if (k->parent() == k->parent()->parent()->r) {
+                u = k->parent()->parent()->l;
+                if (u && u->color() == red) {
+                    u->set_color(black);
+                    k->parent()->set_color(black);
+                    k->parent()->parent()->set_color(red);
+                    k = k->parent()->parent();
+                }
+                else {
+                    if (k == k->parent()->l) {
+                        k = k->parent();
+                        _r_rotate(k);
+                    }
+                    k->parent()->set_color(black);
+                    k->parent()->parent()->set_color(red);
+                    _l_rotate(k->parent()->parent());
+                }
+            }
+            else {
+                u = k->parent()->parent()->r;
+
+                if (u && u->color() == red) {
+                    u->set_color(black);
+                    k->parent()->set_color(black);
+                    k->parent()->parent()->set_color(red);
+                    k = k->parent()->parent();
+                }
+                else {
+                    if (k == k->parent()->r) {
+                        k = k->parent();
+                        _l_rotate(k);
+                    }
+                    k->parent()->set_color(black);
+                    k->parent()->parent()->set_color(red);
+                    _r_rotate(k->parent()->parent());
+                }
+            }
+            if (k == _root)
+                break;
+        }
+        _root->set_color(black);
+    }
+
+public:
+    // Insert elem
+    ft::pair<iterator, bool> insert(const value_type & x){
+        return _insert_node(x, NULL);
+    }
+
+    // Insert hint
+    iterator insert(iterator pos, const value_type & x){
+        (void)pos;
+        return insert(x).first;
+    }
+
+    // Insert range
+    template< class InputIt >
+    void insert( InputIt first, InputIt last ){
+        while (first != last){
+            insert(*first);
+            ++first;
+        }
+    }
+
+private:
+    // inserts x, in premade if it's a node taken from a node_handle
+    ft::pair<iterator, bool> _insert_node(const value_type & x, node_type * premade){
+        ft::pair<iterator, bool> ret = insert_body(_root, x, premade);
+        if (ret.second){
+            _augment_up(ret.first.base());
+            ++_sz();
+            if (_sz() <= 2)
+                _root->set_color(black);
+            else
+                _insert_fix(ret.first.base());
+        }
+        return ret;
+    }
+
+    // nodes inserted back from a node_handle are already built
+    node_type * _new_node(const value_type & x, node_type * premade){
+        if (premade)
+            return premade;
+        return new node_type(x, _alloc());
+    }
+
+    // main function for inserting
+    // qu'on soit clair c'est une ABOMINATION
+    ft::pair<iterator, bool> insert_body(node_type * n, const value_type & x, node_type * premade){
+        while (n->val){
+            // if element exists, return false
+            if (Unique && _key_of(x) == _key(n))
+                return ft::make_pair(n, false);
+            if (_cmp(x, *n->val)){               // left path
+                if (n->l)                       // if it exists, go this way
+                    n = n->l;
+                else {                        // else insert and return
+                    n->l = _new_node(x, premade);
+                    n->l->set_parent(n);
+                    node_type::link_before(n->l, n);
+                    return ft::make_pair(n->l, true);
+                }
+            }
+            else {                       // right path, same as above
+                if (n->r)
+                    n = n->r;
+                else {
+                    n->r = _new_node(x, premade);
+                    n->r->set_parent(n);
+                    node_type::link_after(n->r, n);
+                    return ft::make_pair(n->r, true);
+                }
+            }
+        }
+        // if we get here, it means we've reached end() node
+        node_type *tmp = _new_node(x, premade);
+        tmp->set_parent(n->parent());
+        if (n->parent() && n == n->parent()->r)
+            tmp->r = n;
+        else
+            tmp->l = n;
+        if (_root == n){            // first insertion in tree
+            _root = tmp;
+            tmp->r = n->r;        // separate the 2 end nodes
+            tmp->r->set_parent(tmp);
+            n->r = NULL;
+        }
+        else if (n == n->parent()->r)
+            n->parent()->r = tmp;
+        else
+            n->parent()->l = tmp;
+        n->set_parent(tmp);
+        if (tmp->l == n)
+            node_type::link_after(tmp, n);
+        else
+            node_type::link_before(tmp, n);
+        return ft::make_pair(tmp, true);
+    }
+
+    // ***** erase *****
+private:
+
+    // takes a node's child and its new parent,
+    // sets it if they're not adjacent
+    void _swap_set_parent(node_type* child, node_type* new_parent){
+        if (child && child != new_parent)
+            child->set_parent(new_parent);
+    }
+
+    // takes a node's parent and its new child,
+    // sets it if they're not adjacent
+    void _swap_set_child(node_type* old_child, node_type* new_child){
+        if (old_child->parent() && old_child->parent() != new_child){
+            if (old_child->parent()->l == old_child)
+                old_child->parent()->l = new_child;
+            else
+                old_child->parent()->r = new_child;
+        }
+    }
+
+    // function that swaps 2 nodes,
+    // used, ie, if a node to delete has 2 children
+    // c'est la pire chose que j'ai ecrit de TOUTE ma vie
+    void _swap_nodes(node_type* ptr, node_type* tmp){
+        _swap_set_parent(ptr->l, tmp);
+        _swap_set_parent(ptr->r, tmp);
+        _swap_set_child(ptr, tmp);
+        if (ptr == _root)
+            _root = tmp;
+        else if (tmp == _root)
+            _root = ptr;
+        _swap_set_parent(tmp->l, ptr);
+        _swap_set_parent(tmp->r, ptr);
+        _swap_set_child(tmp, ptr);
+        node_type *old_l = ptr->l;
+        node_type *old_r = ptr->r;
+        node_type *old_p = ptr->parent();
+        color_type old_color = ptr->color();
+        if (tmp->l != ptr)
+            ptr->l = tmp->l;
+        else
+            ptr->l = tmp;
+        if (tmp->r != ptr)
+            ptr->r = tmp->r;
+        else
+            ptr->r = tmp;
+        if (tmp->parent() != ptr)
+            ptr->set_parent(tmp->parent());
+        else
+            ptr->set_parent(tmp);
+        if (old_l != tmp)
+            tmp->l = old_l;
+        else
+            tmp->l = ptr;
+        if (old_r != tmp)
+            tmp->r = old_r;
+        else
+            tmp->r = ptr;
+        if (old_p != tmp)
+            tmp->set_parent(old_p);
+        else
+            tmp->set_parent(ptr);
+        ptr->set_color(tmp->color());
+        tmp->set_color(old_color);
+    }
+
+    // To gain space in fixDoubleBlack
+    bool is_black(node_type *s){
+        if (!s || s->color() == black)
+            return true;
+        return false;
+    }
+
+    // To gain space in fixDoubleBlack
+    bool is_red(node_type *s){
+        if (s && s->color() == red)
+            return true;
+        return false;
+    }
+
+    // For balancing the tree after deletion
+    void fixDoubleBlack(node_type * x, node_type * parent, node_type * sibling){
+        if (x == _root)  // Reached root
+          return;
+
+        if (sibling == NULL) {
+            // No sibiling, recursive call with parent
+            fixDoubleBlack(parent, parent->parent(), parent->sibling());
+        }
+        else {
+            if (sibling->color() == red) {
+                // Sibling is red
+                parent->set_color(red);
+                sibling->set_color(black);
+                if (sibling->isOnLeft()) {
+                    // left case
+                    _r_rotate(parent);
+                    fixDoubleBlack(x, parent, parent->l);
+                }
+                else {
+                    // right case
+                    _l_rotate(parent);
+                    fixDoubleBlack(x, parent, parent->r);
+                }
+            }
+            else {
+                // Sibling is black
+                if (sibling->hasRedChild()) {
+                    // has at least 1 red children
+                    if (sibling->l && sibling->l->val && sibling->l->color() == red) {
+                        if (sibling->isOnLeft()) {
+                            // left left
+                            sibling->l->set_color(sibling->color());
+                            sibling->set_color(parent->color());
+                            _r_rotate(parent);
+                        }
+                        else {
+                            // right left
+                            sibling->l->set_color(parent->color());
+                            _r_rotate(sibling);
+                            _l_rotate(parent);
+                        }
+                    }
+                    else {
+                        if (sibling->isOnLeft()) {
+                            // left right
+                            sibling->r->set_color(parent->color());
+                            _l_rotate(sibling);
+                            _r_rotate(parent);
+                        }
+                        else {
+                            // right right
+                            sibling->r->set_color(sibling->color());
+                            sibling->set_color(parent->color());
+                            _l_rotate(parent);
+                        }
+                  }
+                  parent->set_color(black);
+                }
+                else {
+                    // 2 black children
+                    sibling->set_color(red);
+                    if (parent->color() == red)
+                        parent->set_color(black);
+                    else
+                        fixDoubleBlack(parent, parent->parent(), parent->sibling());
+                }
+            }
+        }
+    }
+
+
+    // set parent's child to target,
+    // and target's parent to deleted node parent
+    void set_parent_target(node_type *ptr, node_type *target){
+        bool isleft = ptr->isOnLeft() ? 1 : 0;
+        if (ptr->parent()){
+            if (isleft)
+                ptr->parent()->l = target;
+            else
+                ptr->parent()->r = target;
+        }
+        else
+            _root = target;
+        _augment_up(ptr->parent());
+        if (target) {
+            target->set_parent(ptr->parent());
+            if (ptr->color() == black) {
+                // If double black (deleted node is black and son is black), fix it
+                if (target->color() == black && target->parent()) {
+                    if (isleft)
+                        fixDoubleBlack(ptr->parent()->l, ptr->parent(), ptr->parent()->r);
+                    else
+                        fixDoubleBlack(ptr->parent()->r, ptr->parent(), ptr->parent()->l);
+                }
+                else
+                    target->set_color(black);
+            }
+        }
+        else if (ptr->color() == black) {
+            if (isleft)
+                fixDoubleBlack(ptr->parent()->l, ptr->parent(), ptr->parent()->r);
+            else
+                fixDoubleBlack(ptr->parent()->r, ptr->parent(), ptr->parent()->l);
+        }
+    }
+
+    // takes the node out of the tree and rebalances it,
+    // the node is returned as if it was just built
+    node_type * _unlink(node_type *ptr){
+        node_type::unlink(ptr);
+        if (_sz() == 1){
+            // only the end() nodes stay, linked like _insert_ends() does
+            node_type *first = _root;
+            node_type *last = _root;
+            while (first->l)
+                first = first->l;
+            while (last->r)
+                last = last->r;
+            first->set_parent(NULL);
+            first->l = NULL;
+            first->r = last;
+            last->set_parent(first);
+            last->l = NULL;
+            last->r = NULL;
+            _augment(last);
+            _augment(first);
+            _root = first;
+            _sz() = 0;
+        }
+        else {
+            while (ptr->l && ptr->r){
+                node_type *tmp = ptr->r;
+                if (tmp->val)
+                    while (tmp->l && tmp->l->val)
+                        tmp = tmp->l;
+                else {
+                    tmp = ptr->l;
+                    while (tmp->r && tmp->r->val)
+                        tmp = tmp->r;
+                }
+                _swap_nodes(ptr, tmp);
+            }
+            if (!ptr->l && !ptr->r)
+                set_parent_target(ptr, NULL);
+            else if (!ptr->l && ptr->r)
+                set_parent_target(ptr, ptr->r);
+            else if (ptr->l && !ptr->r)
+                set_parent_target(ptr, ptr->l);
+            --_sz();
+            if (_sz())
+                _root->set_color(black);
+        }
+        ptr->set_color(red);
+        ptr->l = NULL;
+        ptr->r = NULL;
+        ptr->set_parent(NULL);
+        return ptr;
+    }
+
+public:
+    // erase node at iterator, and reconnect children
+    void erase(iterator pos){
+        node_type *ptr = _unlink(pos.base());
+        _alloc().destroy(ptr->val);
+        _alloc().deallocate(ptr->val, 1);
+        delete ptr;
+    }
+
+    // erase range
+    void erase(iterator first, iterator last){
+        iterator tmp = first;
+        while (first != last){
+            ++tmp;
+            erase(first);
+            first = tmp;
+        }
+    }
+
+    // erase item matching key
+    size_t erase(key_type k){
+        if (!Unique)
+            return _erase_equal(k);
+        iterator it = find(k);
+        if (it == end())
+            return 0;
+        erase(it);
+        return 1;
+    }
+
+private:
+    // every element of k: both ends of the range are found by a descent,
+    // then the nodes in between are taken out one after the other
+    size_t _erase_equal(const key_type & k){
+        iterator it = lower_bound(k);
+        iterator last = upper_bound(k);
+        size_t n = 0;
+        while (it != last){
+            erase(it++);
+            ++n;
+        }
+        return n;
+    }
+
+public:
+    // ***** extract *****
+    // takes the node out, without freeing it nor its value
+    node_handle_type extract(const_iterator pos){
+        return node_handle_type(_unlink(const_cast<node_type *>(pos.base())), _alloc());
+    }
+
+    node_handle_type extract(const key_type & k){
+        node_type *n = _find_node(k);
+        if (!n)
+            return node_handle_type();
+        return node_handle_type(_unlink(n), _alloc());
+    }
+
+    // ***** insert node *****
+    // links the node of nh, if its key isn't there yet.
+    // Otherwise the node is moved to the returned node handle
+    insert_return_type insert(const node_handle_type & nh){
+        insert_return_type ret;
+        ret.inserted = false;
+        if (nh.empty()){
+            ret.position = end();
+            return ret;
+        }
+        ft::pair<iterator, bool> res = _insert_node(*nh._ptr->val, nh._ptr);
+        ret.position = res.first;
+        ret.inserted = res.second;
+        if (res.second)
+            nh._release();
+        else
+            ret.node = nh;
+        return ret;
+    }
+
+    // Insert node hint, nh keeps its node if the key was there
+    iterator insert(const_iterator pos, const node_handle_type & nh){
+        (void)pos;
+        if (nh.empty())
+            return end();
+        ft::pair<iterator, bool> res = _insert_node(*nh._ptr->val, nh._ptr);
+        if (res.second)
+            nh._release();
+        return res.first;
+    }
+
+    // ***** merge *****
+    // moves the nodes of source whose key isn't here yet (all of them
+    // with equal keys), nothing is allocated nor copied
+    void merge(rb_tree& source){
+        if (&source == this)
+            return;
+        iterator it = source.begin();
+        while (it != source.end()){
+            iterator next = it;
+            ++next;
+            if (!Unique || !find_rec(_root, _key_of(*it)))
+                insert(source.extract(it));
+            it = next;
+        }
+    }
+
+    // ***** swap *****
+    void swap(rb_tree& other){
+        node_type tmp;
+
+        if (&other == this)
+            return;
+        // the end() nodes stay in their container, they trade places
+        for (int i = 0; i < 2; ++i){
+            _move_end(&_ends[i], &tmp, _root);
+            _move_end(&other._ends[i], &_ends[i], other._root);
+            _move_end(&tmp, &other._ends[i], _root);
+        }
+        node_type *tmp_root = _root;
+        size_type tmp_sz = _sz();
+        _root = other._root;
+        _sz() = other._sz();
+        other._root = tmp_root;
+        other._sz() = tmp_sz;
+    }
+
+    /*
+     * **************************************
+     * ************** Lookup ****************
+     * **************************************
+    */
+
+public:
+    // ***** count *****
+    // With equal keys, the range between the two bounds is counted:
+    // O(log n) with rb_subtree_size, O(log n + k) for k equal keys without
+    size_t count(const key_type & k) const {
+        if (!Unique)
+            return _count_equal(k, static_cast<const Augment *>(NULL));
+        const_iterator it = find(k);
+        if (it == end())
+            return 0;
+        return 1;
+    }
+
+private:
+    // values before the first one not below k, or after k when after is true
+    size_t _rank(const key_type & k, bool after) const {
+        size_t r = 0;
+        for (node_type *n = _root; n && n->val;){
+            if (after ? !_cmp_k(k, _key(n)) : _cmp_k(_key(n), k)){
+                r += (n->l ? n->l->subtree_size : 0) + 1;
+                n = n->r;
+            }
+            else
+                n = n->l;
+        }
+        return r;
+    }
+
+    size_t _count_equal(const key_type & k, const rb_subtree_size *) const {
+        return _rank(k, true) - _rank(k, false);
+    }
+
+    template <class A>
+    size_t _count_equal(const key_type & k, const A *) const {
+        size_t n = 0;
+        for (const_iterator it = lower_bound(k), last = upper_bound(k); it != last; ++it)
+            ++n;
+        return n;
+    }
+
+public:
+
+    // ***** find *****
+    iterator       find(const key_type & k) {
+        node_type *res = _find_node(k);
+        if (res)
+            return iterator(res);
+        return end();
+    }
+
+    const_iterator find(const key_type & k) const {
+        node_type *res = _find_node(k);
+        if (res)
+            return iterator(res);
+        return end();
+    }
+
+private:
+    // node of k, NULL if none. With equal keys, the first one
+    node_type * _find_node(const key_type & k) const {
+        if (Unique)
+            return find_rec(_root, k);
+        node_type *n = _lower_node(k);
+        return n && !_cmp_k(k, _key(n)) ? n : NULL;
+    }
+
+    // recursive function to find a value
+    node_type * find_rec(node_type *n, const key_type & k) const {
+        if (!n || (n && !n->val))
+            return (NULL);
+        if (k == _key(n))
+            return (n);
+        if (_cmp_k(k, _key(n)))
+            return (find_rec(n->l, k));
+        else
+            return (find_rec(n->r, k));
+    }
+
+    // ***** find_batch *****
+    // Descents of a batch, run level by level in groups of _find_lanes.
+    // Each level takes two passes over the group: the first prefetches
+    // the values of the current nodes, the second compares them and
+    // prefetches the next nodes. While one lane waits on memory the
+    // others work, so the cache misses of a group overlap instead of
+    // being paid one after the other.
+    enum { _find_lanes = 16 };
+
+    template< class ForwardIt, class OutputIt, class Iter >
+    OutputIt _find_batch(ForwardIt first, ForwardIt last, OutputIt out, Iter not_found) const {
+        const key_type  *keys[_find_lanes];
+        node_type       *cur[_find_lanes];
+        node_type       *res[_find_lanes];
+
+        while (first != last){
+            int n = 0;
+            for (; n < _find_lanes && first != last; ++n, ++first){
+                keys[n] = &*first;
+                cur[n] = _root;
+                res[n] = NULL;
+            }
+            int active = n;
+            while (active){
+                for (int i = 0; i < n; ++i)
+                    if (cur[i] && cur[i]->val)
+                        __builtin_prefetch(cur[i]->val);
+                for (int i = 0; i < n; ++i){
+                    node_type *node = cur[i];
+                    if (!node)
+                        continue;
+                    if (!node->val)                         // same as find_rec()
+                        cur[i] = NULL;
+                    else if (Unique && *keys[i] == _key(node)){
+                        res[i] = node;
+                        cur[i] = NULL;
+                    }
+                    else if (!Unique && !_cmp_k(_key(node), *keys[i])){
+                        // same as _find_node(): an equal node is the
+                        // first one only if none is found on its left
+                        if (!_cmp_k(*keys[i], _key(node)))
+                            res[i] = node;
+                        cur[i] = node->l;
+                    }
+                    else
+                        cur[i] = _cmp_k(*keys[i], _key(node)) ? node->l : node->r;
+                    if (cur[i])
+                        __builtin_prefetch(cur[i]);
+                    else
+                        --active;
+                }
+            }
+            for (int i = 0; i < n; ++i)
+                *out++ = res[i] ? Iter(res[i]) : not_found;
+        }
+        return out;
+    }
+
+public:
+    // Writes find(k) to out for every key k of [first, last), in order.
+    // Faster than a loop of find() on large containers (see above)
+    template< class ForwardIt, class OutputIt >
+    OutputIt find_batch(ForwardIt first, ForwardIt last, OutputIt out){
+        return _find_batch(first, last, out, end());
+    }
+
+    template< class ForwardIt, class OutputIt >
+    OutputIt find_batch(ForwardIt first, ForwardIt last, OutputIt out) const {
+        return _find_batch(first, last, out, end());
+    }
+
+    // returns the first element that isn't less than k, or end() if none is found
+    iterator       lower_bound (const key_type& k){
+        node_type *n = _lower_node(k);
+        return n ? iterator(n) : end();
+    }
+
+    const_iterator lower_bound (const key_type& k) const {
+        node_type *n = _lower_node(k);
+        return n ? const_iterator(n) : end();
+    }
+
+    // returns the first element that would go after k, or end() if none is found
+    iterator       upper_bound (const key_type& k){
+        node_type *n = _upper_node(k);
+        return n ? iterator(n) : end();
+    }
+
+    const_iterator upper_bound (const key_type& k) const {
+        node_type *n = _upper_node(k);
+        return n ? const_iterator(n) : end();
+    }
+
+private:
+    // descents for the bounds, NULL if it's end()
+    node_type * _lower_node(const key_type& k) const {
+        return _lower_in(_root, k, NULL);
+    }
+
+    node_type * _upper_node(const key_type& k) const {
+        node_type *ret = NULL;
+        node_type *n = _root;
+        while (n && n->val){
+            if (_cmp_k(k, _key(n))){
+                ret = n;
+                n = n->l;
+            }
+            else
+                n = n->r;
+        }
+        return ret;
+    }
+
+public:
+    // returns a pair made of the return values of lower and upper bound
+    ft::pair<const_iterator,const_iterator> equal_range (const key_type& k) const{
+        return ft::make_pair<const_iterator,const_iterator>(lower_bound(k), upper_bound(k));
+    }
+
+    ft::pair<iterator,iterator> equal_range (const key_type& k){
+        return ft::make_pair<iterator,iterator>(lower_bound(k), upper_bound(k));
+    }
+
+    // ***** finger search *****
+    // Same as lower_bound() and find(), starting from hint instead of
+    // the root: the search climbs from hint only up to the smallest
+    // subtree holding both, then goes down. O(log d) for a key d
+    // elements away from hint, O(log n) at worst.
+    iterator       lower_bound_from(const_iterator hint, const key_type& k){
+        node_type *n = _finger_lower(const_cast<node_type *>(hint.base()), k);
+        return n ? iterator(n) : end();
+    }
+
+    const_iterator lower_bound_from(const_iterator hint, const key_type& k) const {
+        node_type *n = _finger_lower(const_cast<node_type *>(hint.base()), k);
+        return n ? const_iterator(n) : end();
+    }
+
+    iterator       find_from(const_iterator hint, const key_type& k){
+        node_type *n = _finger_lower(const_cast<node_type *>(hint.base()), k);
+        return n && !_cmp_k(k, _key(n)) ? iterator(n) : end();
+    }
+
+    const_iterator find_from(const_iterator hint, const key_type& k) const {
+        node_type *n = _finger_lower(const_cast<node_type *>(hint.base()), k);
+        return n && !_cmp_k(k, _key(n)) ? const_iterator(n) : end();
+    }
+
+private:
+    // lower bound of k in the subtree of n, ret if it's after the subtree
+    node_type * _lower_in(node_type *n, const key_type& k, node_type *ret) const {
+        while (n && n->val){
+            if (!_cmp_k(_key(n), k)){
+                ret = n;
+                n = n->l;
+            }
+            else
+                n = n->r;
+        }
+        return ret;
+    }
+
+    // climbs from n while k may be out of its subtree. Going up from a
+    // left child, the parent is the first node after the subtree,
+    // going up from a right child, it's the last one before.
+    // The end() nodes have no key, the search starts from the root then
+    node_type * _finger_lower(node_type *n, const key_type& k) const {
+        node_type *p;
+
+        if (!n->val)
+            return _lower_node(k);
+        if (_cmp_k(_key(n), k)){        // k is after n
+            for (; (p = n->parent()); n = p){
+                if (!p->val)
+                    return _lower_node(k);
+                if (n == p->l && !_cmp_k(_key(p), k))
+                    return _lower_in(n, k, p);
+            }
+            return _lower_in(n, k, NULL);
+        }
+        for (; (p = n->parent()); n = p){ // k is at n or before
+            if (!p->val)
+                return _lower_node(k);
+            if (n == p->r && _cmp_k(_key(p), k))
+                break;
+        }
+        return _lower_in(n, k, NULL);
+    }
+
+public:
+    /*
+     * **************************************
+     * ************ Set algebra *************
+     * **************************************
+    */
+
+private:
+    typedef ft::sorted_merge<const_iterator, value_compare>  merge_type;
+
+    // Bodies of the non member set_union(), set_intersection(),
+    // set_difference() and includes() of the containers. The result
+    // is built in this one, which must be empty.
+protected:
+    // Elements of both, taken from lhs when in both. O(n + m)
+    void _union_of(const rb_tree& lhs, const rb_tree& rhs){
+        _build_sorted(lhs._merge_with(rhs, merge_type::union_mode), lhs.size() + rhs.size());
+    }
+
+    // Elements of lhs also in rhs, O(n + m),
+    // or O(m log n) when one side is much smaller
+    void _intersection_of(const rb_tree& lhs, const rb_tree& rhs){
+        if (_lookup_is_cheaper(lhs.size(), rhs.size()))
+            _insert_lookups(lhs, rhs, true);
+        else if (_lookup_is_cheaper(rhs.size(), lhs.size())) {
+            for (const_iterator it = rhs.begin(); it != rhs.end(); ++it) {
+                const_iterator found = lhs.find(_key_of(*it));
+                if (found != lhs.end())
+                    insert(*found);
+            }
+        }
+        else
+            _build_sorted(lhs._merge_with(rhs, merge_type::intersection_mode), lhs.size());
+    }
+
+    // Elements of lhs not in rhs, O(n + m),
+    // or O(n log m) when lhs is much smaller
+    void _difference_of(const rb_tree& lhs, const rb_tree& rhs){
+        if (_lookup_is_cheaper(lhs.size(), rhs.size()))
+            _insert_lookups(lhs, rhs, false);
+        else
+            _build_sorted(lhs._merge_with(rhs, merge_type::difference_mode), lhs.size());
+    }
+
+    // True if every key of rhs is here. O(n + m),
+    // or O(m log n) when rhs is much smaller
+    bool _includes(const rb_tree& rhs) const {
+        const_iterator it = rhs.begin();
+        if (rhs.size() > size())
+            return false;
+        if (_lookup_is_cheaper(rhs.size(), size())) {
+            for (; it != rhs.end(); ++it)
+                if (!find_rec(_root, _key_of(*it)))
+                    return false;
+            return true;
+        }
+        const_iterator lit = begin();
+        value_compare cmp = value_comp();
+        while (it != rhs.end()) {
+            while (lit != end() && cmp(*lit, *it))
+                ++lit;
+            if (lit == end() || cmp(*it, *lit))
+                return false;
+            ++it;
+            ++lit;
+        }
+        return true;
+    }
+
+private:
+    merge_type _merge_with(const rb_tree& other, typename merge_type::mode_type mode) const {
+        return merge_type(begin(), end(), other.begin(), other.end(), value_comp(), mode);
+    }
+
+    // Looking up each of the small elements in the large tree
+    // beats walking both trees
+    static bool _lookup_is_cheaper(size_type small, size_type large){
+        size_type depth = 1;
+        for (size_type n = large; n >>= 1; )
+            ++depth;
+        return small * depth < small + large;
+    }
+
+    // Elements of src found (or not) in other, src being much smaller
+    void _insert_lookups(const rb_tree& src, const rb_tree& other, bool found){
+        for (const_iterator it = src.begin(); it != src.end(); ++it)
+            if ((other.find_rec(other._root, _key_of(*it)) != NULL) == found)
+                insert(*it);
+    }
+
+    // ***** sorted build *****
+    // builds the tree of an empty container from sorted values in O(n):
+    // subtrees are split in halves so only the last level may be
+    // incomplete, its nodes are red and every other one is black.
+    // bound is the most elements src can give
+    void _build_sorted(merge_type src, size_type bound){
+        typedef typename Alloc::template rebind<const value_type *>::other  ptr_allocator;
+        ptr_allocator       pal(_alloc());
+        const value_type    **vals;
+        size_type           n = 0;
+        int                 red_depth = 0;
+
+        if (!bound)
+            return;
+        vals = pal.allocate(bound);
+        for (const value_type *v = src.next(); v; v = src.next())
+            vals[n++] = v;
+        if (!n)
+            return pal.deallocate(vals, bound);
+        while ((static_cast<size_type>(2) << red_depth) <= n + 1)
+            ++red_depth;
+        node_type *tree;
+        try { tree = _build_rec(vals, n, 0, red_depth); }
+        catch (...) { pal.deallocate(vals, bound); throw; }
+        pal.deallocate(vals, bound);
+        _attach_ends(tree, n);
+        node_type::thread(_root);
+    }
+
+    node_type * _build_rec(const value_type **vals, size_type n, int depth, int red_depth){
+        if (!n)
+            return NULL;
+        node_type *l = _build_rec(vals, n / 2, depth + 1, red_depth);
+        node_type *node;
+        try { node = new node_type(*vals[n / 2], _alloc()); }
+        catch (...) { destroy_rec(l); throw; }
+        node->l = l;
+        if (l)
+            l->set_parent(node);
+        try { node->r = _build_rec(vals + n / 2 + 1, n - n / 2 - 1, depth + 1, red_depth); }
+        catch (...) { destroy_rec(node); throw; }
+        if (node->r)
+            node->r->set_parent(node);
+        node->set_color(depth == red_depth ? red : black);
+        _augment(node);
+        return node;
+    }
+
+    /*
+     * **************************************
+     * ************ Split / Join ************
+     * **************************************
+    */
+
+    // The algorithms below work on bare red/black trees: the end()
+    // nodes are taken out first, every leaf is NULL, and roots of
+    // subtrees may be red. Nodes are relinked, never copied.
+
+private:
+    typedef enum { op_union, op_intersection, op_difference } set_op_type;
+
+    static const key_type &_key_of(const value_type &v) { return KeyOfValue()(v); }
+    static const key_type &_key(const node_type *n) { return _key_of(*n->val); }
+
+    // Number of black nodes down to the leaves
+    int _black_height(node_type *n) const {
+        int h = 0;
+        for (; n; n = n->l)
+            if (n->color() == black)
+                ++h;
+        return h;
+    }
+
+    static node_type *_leftmost(node_type *n){
+        while (n->l)
+            n = n->l;
+        return n;
+    }
+
+    static node_type *_rightmost(node_type *n){
+        while (n->r)
+            n = n->r;
+        return n;
+    }
+
+    // In order successor in a bare tree, NULL after the last one
+    static node_type *_bare_next(node_type *n){
+        if (n->r)
+            return _leftmost(n->r);
+        while (n->parent() && n == n->parent()->r)
+            n = n->parent();
+        return n->parent();
+    }
+
+    static node_type *_detach(node_type *n){
+        if (n)
+            n->set_parent(NULL);
+        return n;
+    }
+
+    // n becomes the root of l and r
+    static node_type *_make_root(node_type *l, node_type *n, node_type *r, color_type color){
+        n->l = l;
+        n->r = r;
+        n->set_parent(NULL);
+        n->set_color(color);
+        if (l)
+            l->set_parent(n);
+        if (r)
+            r->set_parent(n);
+        _augment(n);
+        return n;
+    }
+
+    // Rotations of a bare subtree, return the new subtree root
+    static node_type *_rotate_l(node_type *x){
+        node_type *y = x->r;
+        x->r = y->l;
+        if (y->l)
+            y->l->set_parent(x);
+        y->l = x;
+        y->set_parent(x->parent());
+        x->set_parent(y);
+        _augment(x);
+        _augment(y);
+        return y;
+    }
+
+    static node_type *_rotate_r(node_type *x){
+        node_type *y = x->l;
+        x->l = y->r;
+        if (y->r)
+            y->r->set_parent(x);
+        y->r = x;
+        y->set_parent(x->parent());
+        x->set_parent(y);
+        _augment(x);
+        _augment(y);
+        return y;
+    }
+
+    // Takes the end() nodes out, the bare tree is returned
+    node_type *_detach_ends(){
+        node_type *first = _leftmost(_root);
+        node_type *last = _rightmost(_root);
+        if (!_sz())
+            return NULL;
+        // first has no left child and last no right one
+        _replace_child(first, first->r);
+        _replace_child(last, last->l);
+        node_type *tree = _root;
+        first->l = first->r = NULL;
+        first->set_parent(NULL);
+        last->l = last->r = NULL;
+        last->set_parent(NULL);
+        first->r = last;
+        last->set_parent(first);
+        node_type::chain(first, last);
+        _augment(last);
+        _augment(first);
+        _root = first;
+        return tree;
+    }
+
+    void _replace_child(node_type *n, node_type *child){
+        if (child)
+            child->set_parent(n->parent());
+        if (!n->parent())
+            _root = child;
+        else if (n == n->parent()->l)
+            n->parent()->l = child;
+        else
+            n->parent()->r = child;
+    }
+
+    // Hangs the end() nodes back at both ends of a bare tree,
+    // the container must be empty (see _insert_ends())
+    void _attach_ends(node_type *tree, size_type sz){
+        if (!tree)
+            return;
+        node_type *first = _root;
+        node_type *last = _root->r;
+        node_type *tmp = _leftmost(tree);
+        node_type::chain(first, tmp);
+        tmp->l = first;
+        first->set_parent(tmp);
+        first->r = NULL;
+        first->set_color(black);
+        tmp = _rightmost(tree);
+        node_type::chain(tmp, last);
+        tmp->r = last;
+        last->set_parent(tmp);
+        last->set_color(black);
+        tree->set_parent(NULL);
+        tree->set_color(black);
+        _augment_up(first);
+        _augment_up(last);
+        _root = tree;
+        _sz() = sz;
+    }
+
+    // ***** join *****
+    // Black heights (h) are passed along with the trees, they
+    // count the black nodes down to a leaf, root included.
+
+    // Tree of l, then k, then r: k goes down the spine of the higher
+    // tree to a black node as high as the other tree, then red/red
+    // conflicts are fixed on the way up. O(|hl - hr|)
+    node_type *_join_right(node_type *l, int hl, node_type *k, node_type *r, int hr){
+        if (!is_red(l) && hl == hr)
+            return _make_root(l, k, r, red);
+        node_type *sub = _join_right(_detach(l->r), hl - (l->color() == black), k, r, hr);
+        l->r = sub;
+        sub->set_parent(l);
+        if (l->color() == black && is_red(sub) && is_red(sub->r)){
+            sub->r->set_color(black);
+            return _rotate_l(l);
+        }
+        _augment(l);
+        return l;
+    }
+
+    node_type *_join_left(node_type *l, int hl, node_type *k, node_type *r, int hr){
+        if (!is_red(r) && hl == hr)
+            return _make_root(l, k, r, red);
+        node_type *sub = _join_left(l, hl, k, _detach(r->l), hr - (r->color() == black));
+        r->l = sub;
+        sub->set_parent(r);
+        if (r->color() == black && is_red(sub) && is_red(sub->l)){
+            sub->l->set_color(black);
+            return _rotate_r(r);
+        }
+        _augment(r);
+        return r;
+    }
+
+    node_type *_join(node_type *l, int hl, node_type *k, node_type *r, int hr, int &h){
+        node_type *ret;
+
+        if (hl > hr){
+            ret = _join_right(l, hl, k, r, hr);
+            h = hl;
+            if (is_red(ret) && is_red(ret->r)){
+                ret->set_color(black);
+                ++h;
+            }
+        }
+        else if (hr > hl){
+            ret = _join_left(l, hl, k, r, hr);
+            h = hr;
+            if (is_red(ret) && is_red(ret->l)){
+                ret->set_color(black);
+                ++h;
+            }
+        }
+        else {
+            ret = _make_root(l, k, r, !is_red(l) && !is_red(r) ? red : black);
+            h = hl + (ret->color() == black);
+        }
+        ret->set_parent(NULL);
+        return ret;
+    }
+
+    // join without a middle node, the last one of l is taken out
+    node_type *_join2(node_type *l, int hl, node_type *r, int hr, int &h){
+        if (!r || !l){
+            h = l ? hl : hr;
+            return l ? l : r;
+        }
+        node_type *last = NULL;
+        l = _split_last(l, hl, last, hl);
+        return _join(l, hl, last, r, hr, h);
+    }
+
+    node_type *_split_last(node_type *n, int hn, node_type *&last, int &h){
+        node_type *l = _detach(n->l);
+        node_type *r = _detach(n->r);
+        int hc = hn - (n->color() == black);
+        if (!r){
+            last = n;
+            h = hc;
+            return l;
+        }
+        int hr;
+        r = _split_last(r, hc, last, hr);
+        return _join(l, hc, n, r, hr, h);
+    }
+
+    // ***** split *****
+    // Keys lower than k end up in l, greater ones in r,
+    // and the node of k (if any) is returned. O(log n)
+    node_type *_split(node_type *n, int hn, const key_type &k,
+                      node_type *&l, int &hl, node_type *&r, int &hr){
+        if (!n){
+            l = r = NULL;
+            hl = hr = 0;
+            return NULL;
+        }
+        node_type *nl = _detach(n->l);
+        node_type *nr = _detach(n->r);
+        int hc = hn - (n->color() == black);
+        node_type *found;
+        if (_cmp_k(k, _key(n))){
+            found = _split(nl, hc, k, l, hl, r, hr);
+            r = _join(r, hr, n, nr, hc, hr);
+        }
+        else if (_cmp_k(_key(n), k)){
+            found = _split(nr, hc, k, l, hl, r, hr);
+            l = _join(nl, hc, n, l, hl, hl);
+        }
+        else {
+            l = nl;
+            r = nr;
+            hl = hr = hc;
+            found = n;
+        }
+        return found;
+    }
+
+    // ***** set operations *****
+    void _free_node(node_type *n){
+        _alloc().destroy(n->val);
+        _alloc().deallocate(n->val, 1);
+        delete n;
+    }
+
+    size_type _free_tree(node_type *n){
+        size_type freed = 0;
+        while (n){
+            node_type *r = n->r;
+            freed += _free_tree(n->l) + 1;
+            _free_node(n);
+            n = r;
+        }
+        return freed;
+    }
+
+    // one half of a parallel set operation
+    struct _set_op_task {
+        rb_tree     *self;
+        set_op_type op;
+        node_type   *t1;
+        int         h1;
+        node_type   *t2;
+        int         h2;
+        int         forks;
+        node_type   *ret;
+        int         h;
+        size_type   freed;
+
+        void operator()() {
+            freed = 0;
+            ret = self->_set_op(op, t1, h1, t2, h2, forks, freed, h);
+        }
+    };
+    friend struct _set_op_task;
+
+    // t1 op t2, the nodes of t1 are kept when the key is in both.
+    // Every node not in the result is freed and counted in freed.
+    // t2 is split around the root of t1, both halves are done in
+    // parallel while forks is positive, and joined back with the root.
+    // O(m log(n / m + 1)) for sizes m <= n.
+    node_type *_set_op(set_op_type op, node_type *t1, int h1, node_type *t2, int h2,
+                       int forks, size_type &freed, int &h){
+        if (!t1 || !t2){
+            if (op == op_union){
+                h = t1 ? h1 : h2;
+                return t1 ? t1 : t2;
+            }
+            freed += _free_tree(op == op_intersection ? t1 : NULL) + _free_tree(t2);
+            h = op == op_intersection ? 0 : h1;
+            return op == op_intersection ? NULL : t1;
+        }
+        int hc = h1 - (t1->color() == black);
+        _set_op_task tasks[2] = {
+            { this, op, _detach(t1->l), hc, NULL, 0, forks - 1, NULL, 0, 0 },
+            { this, op, _detach(t1->r), hc, NULL, 0, forks - 1, NULL, 0, 0 }
+        };
+        node_type *dup = _split(t2, h2, _key(t1), tasks[0].t2, tasks[0].h2,
+                                tasks[1].t2, tasks[1].h2);
+        fork_join(tasks[0], tasks[1], forks > 0);
+        freed += tasks[0].freed + tasks[1].freed;
+        if (dup){
+            _free_node(dup);
+            ++freed;
+        }
+        bool keep_root = (op == op_union) || ((dup != NULL) == (op == op_intersection));
+        if (keep_root)
+            return _join(tasks[0].ret, tasks[0].h, t1, tasks[1].ret, tasks[1].h, h);
+        _free_node(t1);
+        ++freed;
+        return _join2(tasks[0].ret, tasks[0].h, tasks[1].ret, tasks[1].h, h);
+    }
+
+    // Runs op between this and other, other is emptied
+    void _parallel_set_op(set_op_type op, rb_tree &other, unsigned threads){
+        size_type total = _sz() + other._sz();
+        size_type freed = 0;
+        node_type *t1 = _detach_ends();
+        node_type *t2 = other._detach_ends();
+        int h;
+        other._sz() = 0;
+        _sz() = 0;
+        node_type *tree = _set_op(op, t1, _black_height(t1), t2, _black_height(t2),
+                                  fork_depth(threads), freed, h);
+        _attach_ends(tree, total - freed);
+        node_type::thread(_root);
+    }
+
+    // ***** sorted batch *****
+    struct _node_less {
+        key_compare cmp;
+
+        _node_less(const key_compare &c): cmp(c) {}
+        bool operator()(const node_type *a, const node_type *b) const {
+            return cmp(_key(a), _key(b));
+        }
+    };
+    friend struct _node_less;
+
+    // Links n sorted nodes in a balanced tree, like _build_sorted()
+    node_type *_link_sorted(node_type **nodes, size_type n, int depth, int red_depth){
+        if (!n)
+            return NULL;
+        node_type *l = _link_sorted(nodes, n / 2, depth + 1, red_depth);
+        node_type *r = _link_sorted(nodes + n / 2 + 1, n - n / 2 - 1, depth + 1, red_depth);
+        return _make_root(l, nodes[n / 2], r, depth == red_depth ? red : black);
+    }
+
+public:
+    // split(), join(), the parallel set operations and insert_batch()
+    // need unique keys: multimap and multiset don't have them.
+
+    // ***** split *****
+    // Keeps the keys lower than k, the others are moved to right
+    // (its previous content is freed). The tree is cut in O(log n),
+    // then the smaller side is counted to know both sizes.
+    void split(const key_type &k, rb_tree &right){
+        if (&right == this)
+            return;
+        right.clear();
+        size_type total = _sz();
+        node_type *l;
+        node_type *r;
+        node_type *tree = _detach_ends();
+        int hl;
+        int hr;
+        node_type *found = _split(tree, _black_height(tree), k, l, hl, r, hr);
+        _sz() = 0;
+        if (found)
+            r = _join(NULL, 0, found, r, hr, hr);
+        // both sides are counted in turns, until the smaller one ends
+        size_type n = 0;
+        node_type *a = l ? _leftmost(l) : NULL;
+        node_type *b = r ? _leftmost(r) : NULL;
+        while (a && b){
+            a = _bare_next(a);
+            b = _bare_next(b);
+            ++n;
+        }
+        _attach_ends(l, a ? total - n : n);
+        right._attach_ends(r, a ? n : total - n);
+    }
+
+    // ***** join *****
+    // Appends right, emptied, in O(log n) if all its keys are greater
+    // than the ones here. Otherwise works like parallel_union()
+    void join(rb_tree &right, unsigned threads = 0){
+        if (&right == this || right.empty())
+            return;
+        if (!empty() && !_cmp_k(_key((--end()).base()), _key(right.begin().base())))
+            return parallel_union(right, threads);
+        size_type total = _sz() + right._sz();
+        node_type *l = _detach_ends();
+        node_type *r = right._detach_ends();
+        node_type *none;
+        int hl = _black_height(l);
+        int hr = _black_height(r);
+        int h;
+        right._sz() = 0;
+        _sz() = 0;
+        // the first node of right is taken as the middle one
+        node_type *mid = _split(r, hr, _key(_leftmost(r)), none, h, r, hr);
+        if (l)
+            node_type::chain(_rightmost(l), mid);
+        _attach_ends(_join(l, hl, mid, r, hr, h), total);
+    }
+
+    // ***** parallel set operations *****
+    // Split/join based, other is emptied and every node not kept is
+    // freed. With m <= n elements, the work is O(m log(n / m + 1)),
+    // spread on threads (0 for one per cpu). The allocator has to be
+    // thread safe when using more than one thread.
+
+    // Adds the elements of other whose key isn't here
+    void parallel_union(rb_tree &other, unsigned threads = 0){
+        if (&other != this)
+            _parallel_set_op(op_union, other, threads);
+    }
+
+    // Keeps the elements whose key is in other
+    void parallel_intersection(rb_tree &other, unsigned threads = 0){
+        if (&other != this)
+            _parallel_set_op(op_intersection, other, threads);
+    }
+
+    // Keeps the elements whose key isn't in other
+    void parallel_difference(rb_tree &other, unsigned threads = 0){
+        if (&other == this)
+            return clear();
+        _parallel_set_op(op_difference, other, threads);
+    }
+
+    // ***** insert_batch *****
+    // Inserts a range in one go: it is sorted and built in a tree,
+    // then united to this one with parallel_union(). Like insert(),
+    // keys already here, or repeated in the range, keep their first value
+    template< class InputIt >
+    void insert_batch(InputIt first, InputIt last, unsigned threads = 0){
+        typedef typename Alloc::template rebind<node_type *>::other  ptr_allocator;
+        ptr_allocator   pal(_alloc());
+        node_type       **nodes = NULL;
+        size_type       cap = 0;
+        size_type       n = 0;
+
+        try {
+            for (; first != last; ++first){
+                if (n == cap){
+                    node_type **tmp = pal.allocate(cap ? cap * 2 : 16);
+                    std::copy(nodes, nodes + n, tmp);
+                    if (nodes)
+                        pal.deallocate(nodes, cap);
+                    nodes = tmp;
+                    cap = cap ? cap * 2 : 16;
+                }
+                nodes[n] = new node_type(*first, _alloc());
+                ++n;
+            }
+        }
+        catch (...) {
+            while (n)
+                _free_node(nodes[--n]);
+            if (nodes)
+                pal.deallocate(nodes, cap);
+            throw;
+        }
+        if (!n)
+            return;
+        _node_less less(key_comp());
+        std::stable_sort(nodes, nodes + n, less);
+        size_type kept = 1;
+        for (size_type i = 1; i < n; ++i){
+            if (less(nodes[kept - 1], nodes[i]))
+                nodes[kept++] = nodes[i];
+            else
+                _free_node(nodes[i]);
+        }
+        int red_depth = 0;
+        while ((static_cast<size_type>(2) << red_depth) <= kept + 1)
+            ++red_depth;
+        rb_tree batch(key_comp(), _alloc());
+        batch._attach_ends(_link_sorted(nodes, kept, 0, red_depth), kept);
+        pal.deallocate(nodes, cap);
+        parallel_union(batch, threads);
+    }
+
+public:
+    /*
+     * **************************************
+     * ************ Observers ***************
+     * **************************************
+    */
+
+public:
+    // returns
+    key_compare   key_comp()   const { return _cmp_al_sz.first().first(); }
+    value_compare value_comp() const { return value_compare(_cmp_al_sz.first().first()); }
+
+
+};  // --------- End of rb_tree
+
+
+    /*
+     * **************************************
+     * ** Non member - Relational operator **
+     * **************************************
+     *
+     * Shared by the containers, found through their rb_tree base
+    */
+
+template< class K, class V, class KoV, class C, class A, class Aug, bool U >
+bool operator==( const ft::rb_tree<K,V,KoV,C,A,Aug,U>& lhs,
+                 const ft::rb_tree<K,V,KoV,C,A,Aug,U>& rhs ){
+    if (lhs.size() != rhs.size())
+        return false;
+    typename ft::rb_tree<K,V,KoV,C,A,Aug,U>::const_iterator lit = lhs.begin();
+    typename ft::rb_tree<K,V,KoV,C,A,Aug,U>::const_iterator rit = rhs.begin();
+    while (lit != lhs.end())
+        if (*lit++ != *rit++)
+            return false;
+    return true;
+}
+
+template< class K, class V, class KoV, class C, class A, class Aug, bool U >
+bool operator!=( const ft::rb_tree<K,V,KoV,C,A,Aug,U>& lhs,
+                 const ft::rb_tree<K,V,KoV,C,A,Aug,U>& rhs ){
+    return !(lhs == rhs);
+}
+
+template< class K, class V, class KoV, class C, class A, class Aug, bool U >
+bool operator<( const ft::rb_tree<K,V,KoV,C,A,Aug,U>& lhs,
+                const ft::rb_tree<K,V,KoV,C,A,Aug,U>& rhs ){
+    return ft::lexicographical_compare(lhs.begin(), lhs.end(),
+                                        rhs.begin(), rhs.end());
+}
+
+template< class K, class V, class KoV, class C, class A, class Aug, bool U >
+bool operator>(const ft::rb_tree<K,V,KoV,C,A,Aug,U>& lhs,
+               const ft::rb_tree<K,V,KoV,C,A,Aug,U>& rhs) {
+    return (!(lhs == rhs) && !(lhs < rhs));
+}
+
+template< class K, class V, class KoV, class C, class A, class Aug, bool U >
+bool operator<=(const ft::rb_tree<K,V,KoV,C,A,Aug,U>& lhs,
+                const ft::rb_tree<K,V,KoV,C,A,Aug,U>& rhs) {
+    return ((lhs == rhs) || (lhs < rhs));
+}
+
+template< class K, class V, class KoV, class C, class A, class Aug, bool U >
+bool operator>=(const ft::rb_tree<K,V,KoV,C,A,Aug,U>& lhs,
+                const ft::rb_tree<K,V,KoV,C,A,Aug,U>& rhs) {
+    return ((lhs == rhs) || !(lhs < rhs));
+}
+
+} // --------- End of ft namespace
+
+#endif
@@ -0,0 +1,74 @@
+#ifndef SORTED_MERGE_HPP
+# define SORTED_MERGE_HPP
+
+// needed for iterator_traits
+# include "type_traits.hpp"
+
+# include <cstddef> // needed for NULL
+
+namespace ft
+{
+
+/*
+ * Walks two sorted ranges at once and gives, in order, the elements of
+ * their union, intersection or difference (first minus second).
+ * An element found in both ranges is taken from the first one.
+ * Used by the set algebra of map and set, in O(n + m).
+*/
+template <class Iter, class Compare>
+class sorted_merge {
+    public:
+    typedef typename iterator_traits<Iter>::pointer pointer;
+
+    enum mode_type { union_mode, intersection_mode, difference_mode };
+
+    private:
+    Iter        _f1;
+    Iter        _l1;
+    Iter        _f2;
+    Iter        _l2;
+    Compare     _cmp;
+    mode_type   _mode;
+
+    public:
+    sorted_merge(Iter first1, Iter last1, Iter first2, Iter last2,
+                 Compare cmp, mode_type mode):
+        _f1(first1), _l1(last1), _f2(first2), _l2(last2),
+        _cmp(cmp), _mode(mode) {}
+
+    // Next element of the result, NULL once done
+    pointer next() {
+        while (true) {
+            if (_f1 == _l1) {
+                if (_mode != union_mode || _f2 == _l2)
+                    return NULL;
+                return &*_f2++;
+            }
+            if (_f2 == _l2) {
+                if (_mode == intersection_mode)
+                    return NULL;
+                return &*_f1++;
+            }
+            if (_cmp(*_f1, *_f2)) {         // only in first
+                if (_mode != intersection_mode)
+                    return &*_f1++;
+                ++_f1;
+            }
+            else if (_cmp(*_f2, *_f1)) {    // only in second
+                if (_mode == union_mode)
+                    return &*_f2++;
+                ++_f2;
+            }
+            else {                          // in both
+                ++_f2;
+                if (_mode != difference_mode)
+                    return &*_f1++;
+                ++_f1;
+            }
+        }
+    }
+};
+
+}
+
+#endif
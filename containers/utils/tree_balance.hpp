@@ -0,0 +1,250 @@
+#ifndef TREE_BALANCE_HPP
+# define TREE_BALANCE_HPP
+
+# include <cstddef> // needed for NULL and size_t
+
+namespace ft
+{
+
+/*
+ * Balancing policies of bs_tree (avl_map, treap_map, splay_map).
+ *
+ * A policy gives the data it keeps in each node (node_data, a base of
+ * the nodes) and what it does to the tree:
+ *     inserted(n)  n was just linked as a leaf
+ *     remove(n)    takes n out of the tree
+ *     accessed(n)  a lookup ended at n, found or not
+ *
+ * Nodes have l, r and p links. The root hangs on the left of the end()
+ * node, the only node without a value: every node has a parent, so
+ * the rotations have no special case for the root.
+*/
+
+// ***** shared by the policies *****
+struct bst_balance {
+    template <class Node>
+    static void rotate_left(Node *x) {
+        Node *y = x->r;
+        x->r = y->l;
+        if (y->l)
+            y->l->p = x;
+        replace(x, y);
+        y->l = x;
+        x->p = y;
+    }
+
+    template <class Node>
+    static void rotate_right(Node *x) {
+        Node *y = x->l;
+        x->l = y->r;
+        if (y->r)
+            y->r->p = x;
+        replace(x, y);
+        y->r = x;
+        x->p = y;
+    }
+
+    // x goes one level up, above its parent
+    template <class Node>
+    static void rotate_up(Node *x) {
+        if (x == x->p->l)
+            rotate_right(x->p);
+        else
+            rotate_left(x->p);
+    }
+
+    // c (may be NULL) takes the place of n under n's parent
+    template <class Node>
+    static void replace(Node *n, Node *c) {
+        if (n == n->p->l)
+            n->p->l = c;
+        else
+            n->p->r = c;
+        if (c)
+            c->p = n->p;
+    }
+
+    // Plain removal: with two children, n's successor takes its place
+    // and its balance data. Returns the lowest node whose subtree lost
+    // a node
+    template <class Node>
+    static Node *remove(Node *n) {
+        if (!n->l || !n->r) {
+            replace(n, n->l ? n->l : n->r);
+            return n->p;
+        }
+        Node *s = n->r;
+        while (s->l)
+            s = s->l;
+        Node *from = s;
+        if (s->p != n) {
+            from = s->p;
+            replace(s, s->r);
+            s->r = n->r;
+            s->r->p = s;
+        }
+        s->l = n->l;
+        s->l->p = s;
+        replace(n, s);
+        static_cast<typename Node::balance_data &>(*s) =
+            static_cast<const typename Node::balance_data &>(*n);
+        return from;
+    }
+};
+
+// ***** AVL *****
+// Heights of the two children of a node differ by one at most: the
+// tree is at most 1.44 log n high (2 log n for red/black trees), so
+// lookups are shorter, and insert and erase rotate a bit more
+struct avl_balance : bst_balance {
+    struct node_data {
+        int height;
+
+        node_data(): height(1) {}
+    };
+
+    template <class Node>
+    static void inserted(Node *n) { _retrace(n->p); }
+
+    template <class Node>
+    static void remove(Node *n) { _retrace(bst_balance::remove(n)); }
+
+    template <class Node>
+    static void accessed(Node *) {}
+
+private:
+    template <class Node>
+    static int _height(const Node *n) { return n ? n->height : 0; }
+
+    template <class Node>
+    static void _fix_height(Node *n) {
+        int l = _height(n->l);
+        int r = _height(n->r);
+        n->height = 1 + (l > r ? l : r);
+    }
+
+    // returns the root of the subtree after the rotations
+    template <class Node>
+    static Node *_rebalance(Node *n) {
+        int balance = _height(n->l) - _height(n->r);
+        if (balance > 1) {
+            if (_height(n->l->l) < _height(n->l->r)) {
+                rotate_left(n->l);
+                _fix_height(n->l->l);
+            }
+            rotate_right(n);
+        }
+        else if (balance < -1) {
+            if (_height(n->r->r) < _height(n->r->l)) {
+                rotate_right(n->r);
+                _fix_height(n->r->r);
+            }
+            rotate_left(n);
+        }
+        else {
+            _fix_height(n);
+            return n;
+        }
+        _fix_height(n);
+        _fix_height(n->p);
+        return n->p;
+    }
+
+    // from n up to the root, stops at the first subtree that keeps its
+    // height: nothing changed above
+    template <class Node>
+    static void _retrace(Node *n) {
+        while (n->val) {
+            int old = n->height;
+            n = _rebalance(n);
+            if (n->height == old)
+                return;
+            n = n->p;
+        }
+    }
+};
+
+// ***** treap *****
+// Binary heap on random priorities: the expected height is O(log n)
+// whatever the order of the keys. The priority is a hash of the node
+// address, nothing is kept in the node
+struct treap_balance : bst_balance {
+    struct node_data {};
+
+    template <class Node>
+    static void inserted(Node *n) {
+        while (n->p->val && _priority(n) > _priority(n->p))
+            rotate_up(n);
+    }
+
+    // n goes down under its highest priority child, until it has only one
+    template <class Node>
+    static void remove(Node *n) {
+        while (n->l && n->r) {
+            if (_priority(n->l) > _priority(n->r))
+                rotate_right(n);
+            else
+                rotate_left(n);
+        }
+        bst_balance::remove(n);
+    }
+
+    template <class Node>
+    static void accessed(Node *) {}
+
+private:
+    template <class Node>
+    static std::size_t _priority(const Node *n) {
+        std::size_t x = reinterpret_cast<std::size_t>(n);
+        x ^= (x >> 16) >> 16;
+        x ^= x >> 16;
+        x *= 0x45d9f3b;
+        x ^= x >> 16;
+        x *= 0x45d9f3b;
+        x ^= x >> 16;
+        return x;
+    }
+};
+
+// ***** splay *****
+// Each node found or inserted is moved up to the root: recently used
+// keys stay close to it, so skewed lookups (a few hot keys) are short.
+// O(log n) amortized, a single operation can be O(n). Lookups change
+// the tree: only the non const ones splay
+struct splay_balance : bst_balance {
+    struct node_data {};
+
+    template <class Node>
+    static void inserted(Node *n) { _splay(n); }
+
+    template <class Node>
+    static void remove(Node *n) {
+        _splay(n);
+        bst_balance::remove(n);
+    }
+
+    template <class Node>
+    static void accessed(Node *n) { _splay(n); }
+
+private:
+    template <class Node>
+    static void _splay(Node *x) {
+        while (x->p->val) {
+            Node *p = x->p;
+            if (!p->p->val)
+                rotate_up(x);                       // zig
+            else if ((x == p->l) == (p == p->p->l)) {
+                rotate_up(p);                       // zig-zig
+                rotate_up(x);
+            }
+            else {
+                rotate_up(x);                       // zig-zag
+                rotate_up(x);
+            }
+        }
+    }
+};
+
+}
+
+#endif
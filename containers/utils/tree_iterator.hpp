@@ -0,0 +1,92 @@
+#ifndef TREE_ITERATOR_HPP
+# define TREE_ITERATOR_HPP
+
+// needed for iterator_traits
+# include "type_traits.hpp"
+
+
+namespace ft
+{
+
+template <class T, class node_type> class tree_iterator
+{
+    public:
+    // iterator_traits
+    typedef T                                value_type;
+    typedef ptrdiff_t                        difference_type;
+    typedef T*                               pointer;
+    typedef T&                               reference;
+    typedef std::bidirectional_iterator_tag  iterator_category;
+
+    private:
+    node_type* _ptr; // only variable, iterator position
+
+
+    public:
+    // Const conversion
+    operator tree_iterator<const T, const node_type> () const {
+        return (tree_iterator<const T, const node_type> (this->_ptr));
+    }
+    // Constructors
+    tree_iterator():_ptr(NULL){}
+    tree_iterator(tree_iterator const &it):_ptr(it._ptr){}
+
+    tree_iterator(node_type* p):_ptr(p){}
+
+    // Assignement operator
+    tree_iterator& operator=(const tree_iterator& it){
+        _ptr = it._ptr;
+        return *this;
+    }
+
+    // Member access operators
+    value_type& operator * () const {return *_ptr->val;}
+    pointer     operator -> () const {return _ptr->val;}
+
+    // Pre-increment, see tree_links.hpp
+    tree_iterator& operator++() {
+        _ptr = node_type::next(_ptr);
+        return *this;
+    }
+
+    // Post-increment
+    tree_iterator operator++(int) { tree_iterator copy(*this); ++*this; return copy;}
+
+    // Pre-decrement
+    tree_iterator& operator--() {
+        _ptr = node_type::prev(_ptr);
+        return *this;
+    }
+
+    // Post-decrement
+    tree_iterator operator--(int) { tree_iterator copy(*this); --*this; return copy;}
+
+
+    // Comparison operators
+    bool operator==(tree_iterator const &it) const { return _ptr == it._ptr; }
+    bool operator!=(tree_iterator const &it) const { return _ptr != it._ptr; }
+
+    bool operator<(tree_iterator const &it) const { return _ptr < it._ptr; }
+    bool operator>(tree_iterator const &it) const { return _ptr > it._ptr; }
+
+    bool operator<=(tree_iterator const &it) const { return _ptr <= it._ptr; }
+    bool operator>=(tree_iterator const &it) const { return _ptr >= it._ptr; }
+
+    // Needed for const comparisons
+        node_type* base() const {
+            return _ptr;
+        }
+
+}; // end of tree_iterator
+
+/* for iterator != const_iterator */
+template<typename T_L, typename N_L, typename T_R, typename N_R>
+bool operator!=(const tree_iterator<T_L, N_L> lhs,
+          const tree_iterator<T_R, N_R> rhs) {
+    return (lhs.base() != rhs.base());
+}
+
+} // end of ft namespace
+
+#endif
+
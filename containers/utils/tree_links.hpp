@@ -0,0 +1,145 @@
+#ifndef TREE_LINKS_HPP
+# define TREE_LINKS_HPP
+
+# include <cstddef> // needed for NULL
+
+namespace ft
+{
+
+/*
+ * In order links of the map and set nodes.
+ * By default a node only knows its parent and children, the iterators
+ * climb the tree to find the next node: O(1) on average over a whole
+ * scan, but O(log n) for a single step and a lot of parents visited.
+ *
+ * A key type can opt in to threaded nodes, that also keep links to the
+ * previous and next nodes (end() nodes included): a step is then one
+ * load, for two more pointers per node and a bit of work on insert and
+ * erase. Bulk operations that interleave trees (parallel set operations,
+ * insert_batch, set algebra) thread their result again in O(n).
+ *
+ *     namespace ft {
+ *         template <> struct threaded_nodes<my_key> { static const bool value = true; };
+ *     }
+*/
+template <class Key>
+struct threaded_nodes { static const bool value = false; };
+
+// Base of the nodes, Node is the node type itself
+template <class Node, bool Threaded>
+struct tree_links;
+
+// ***** parent/children only *****
+template <class Node>
+struct tree_links<Node, false> {
+    // next node, the last one has the end() node on its right
+    template <class P>
+    static P next(P n) {
+        if (n->r) {
+            n = n->r;
+            while (n->l)
+                n = n->l;
+            return n;
+        }
+        while (n != n->parent()->l)
+            n = n->parent();
+        return n->parent();
+    }
+
+    // previous node, the first one has an end() node on its left
+    template <class P>
+    static P prev(P n) {
+        if (n->l) {
+            n = n->l;
+            while (n->r)
+                n = n->r;
+            return n;
+        }
+        while (n != n->parent()->r)
+            n = n->parent();
+        return n->parent();
+    }
+
+    // nothing to keep up to date
+    static void chain(Node *, Node *) {}
+    static void link_after(Node *, Node *) {}
+    static void link_before(Node *, Node *) {}
+    static void unlink(Node *) {}
+    static void relink(Node *) {}
+    static void thread(Node *) {}
+};
+
+// ***** threaded *****
+template <class Node>
+struct tree_links<Node, true> {
+    Node *  pred;
+    Node *  succ;
+
+    tree_links(): pred(NULL), succ(NULL) {}
+
+    template <class P>
+    static P next(P n) { return n->succ; }
+
+    template <class P>
+    static P prev(P n) { return n->pred; }
+
+    // a goes right before b
+    static void chain(Node *a, Node *b) {
+        a->succ = b;
+        b->pred = a;
+    }
+
+    static void link_after(Node *n, Node *pos) {
+        chain(n, pos->succ);
+        chain(pos, n);
+    }
+
+    static void link_before(Node *n, Node *pos) {
+        chain(pos->pred, n);
+        chain(n, pos);
+    }
+
+    static void unlink(Node *n) {
+        chain(n->pred, n->succ);
+        n->pred = NULL;
+        n->succ = NULL;
+    }
+
+    // n was copied to a new place, its neighbours are told
+    static void relink(Node *n) {
+        if (n->pred)
+            n->pred->succ = n;
+        if (n->succ)
+            n->succ->pred = n;
+    }
+
+    // links every node of the tree of root in order, O(n)
+    static void thread(Node *root) {
+        Node *last = NULL;
+        Node *n = root;
+
+        while (n->l)
+            n = n->l;
+        n->pred = NULL;
+        while (n) {
+            if (last)
+                chain(last, n);
+            last = n;
+            if (n->r) {
+                n = n->r;
+                while (n->l)
+                    n = n->l;
+            }
+            else {
+                while (n->parent() && n == n->parent()->r)
+                    n = n->parent();
+                n = n->parent();
+            }
+        }
+        last->succ = NULL;
+    }
+};
+
+}
+
+#endif
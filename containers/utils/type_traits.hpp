@@ -132,5 +132,64 @@ struct is_integral : public is_integral_type<T> { };
 
 // ***** end *****
 
+// ****** is_class ******
+//  true for classes, structs and unions: only they can have
+//  pointers to members
+template <typename T>
+struct is_class {
+private:
+    template <typename U> static char   test(int U::*);
+    template <typename U> static long   test(...);
+public:
+    static const bool value = sizeof(test<T>(0)) == 1;
+};
+
+// ****** is_empty ******
+//  true for classes without any non-static data member (std::less,
+//  std::allocator...): deriving from them adds nothing to the size
+template <typename T, bool = is_class<T>::value>
+struct is_empty_base { static const bool value = false; };
+
+template <typename T>
+struct is_empty_base<T, true> {
+private:
+    struct with_base : T { int x; };
+    struct without_base { int x; };
+public:
+    static const bool value = sizeof(with_base) == sizeof(without_base);
+};
+
+template <typename T>
+struct is_empty : public is_empty_base<T> { };
+
+// ***** end *****
+
+// ****** is_trivially_relocatable ******
+//  true when a T can be moved to another address by copying its bytes,
+//  as nothing in it points into itself: vector then reallocates with
+//  one memcpy, instead of a copy and a destruction per element.
+//  Integers, floating points and pointers are, classes opt in with a
+//  specialization.
+template <typename T> struct is_trivially_relocatable :
+    public is_integral_base<is_integral<T>::value, T> {};
+
+template <typename T> struct is_trivially_relocatable<T*> :
+    public is_integral_base<true, T*> {};
+template <> struct is_trivially_relocatable<float> :
+    public is_integral_base<true, float> {};
+template <> struct is_trivially_relocatable<double> :
+    public is_integral_base<true, double> {};
+template <> struct is_trivially_relocatable<long double> :
+    public is_integral_base<true, long double> {};
+
+// ***** end *****
+
+// ****** remove_const ******
+//  T without its top level const
+template <typename T> struct remove_const { typedef T type; };
+template <typename T> struct remove_const<const T> { typedef T type; };
+
+// ***** end *****
+
 }
 #endif
@@ -0,0 +1,173 @@
+#ifndef BIT_ITERATOR_HPP
+# define BIT_ITERATOR_HPP
+
+// needed for iterator_traits
+# include "../utils/type_traits.hpp"
+
+namespace ft
+{
+
+// vector<bool> keeps its bits in words, bit i is bit i % bit_word_size
+// of word i / bit_word_size
+typedef unsigned long   bit_word;
+
+enum { bit_word_size = sizeof(bit_word) * 8 };
+
+// ****** bit_reference ******
+// What vector<bool>'s operator[] and iterators give: a bit can't be
+// referenced, this proxy reads and writes it in its word
+class bit_reference
+{
+    bit_word *  _word;
+    bit_word    _mask;
+
+    public:
+    bit_reference(bit_word *word, bit_word mask): _word(word), _mask(mask) {}
+
+    operator bool () const { return (*_word & _mask) != 0; }
+    bool operator ~ () const { return (*_word & _mask) == 0; }
+
+    bit_reference& operator=(bool x) {
+        if (x)
+            *_word |= _mask;
+        else
+            *_word &= ~_mask;
+        return *this;
+    }
+    bit_reference& operator=(const bit_reference& x) { return *this = bool(x); }
+
+    bool operator==(const bit_reference& x) const { return bool(*this) == bool(x); }
+    bool operator<(const bit_reference& x) const { return !bool(*this) && bool(x); }
+
+    void flip() { *_word ^= _mask; }
+};
+
+// What the iterators give: a proxy, or a plain bool when const
+template <class Word> struct bit_iterator_ref {
+    typedef bit_reference   type;
+    static type make(Word *word, unsigned off) { return type(word, bit_word(1) << off); }
+};
+
+template <> struct bit_iterator_ref<const bit_word> {
+    typedef bool            type;
+    static type make(const bit_word *word, unsigned off) { return (*word >> off) & 1; }
+};
+
+// ****** bit_iterator ******
+// bit_iterator<bit_word> is vector<bool>::iterator,
+// bit_iterator<const bit_word> its const_iterator
+template <class Word> class bit_iterator
+{
+    public:
+    // iterator_traits
+    typedef bool                                        value_type;
+    typedef ptrdiff_t                                   difference_type;
+    typedef void                                        pointer;
+    typedef typename bit_iterator_ref<Word>::type       reference;
+    typedef std::random_access_iterator_tag             iterator_category;
+
+    private:
+    Word *      _word;  // word of the bit
+    unsigned    _off;   // bit in the word
+
+    public:
+    // Const conversion
+    operator bit_iterator<const Word> () const {
+        return (bit_iterator<const Word>(_word, _off));
+    }
+
+    // Constructors
+    bit_iterator(): _word(NULL), _off(0) {}
+    bit_iterator(Word *word, unsigned off): _word(word), _off(off) {}
+
+    // Member access operators
+    reference operator * () const { return bit_iterator_ref<Word>::make(_word, _off); }
+    reference operator [] (difference_type n) const { return *(*this + n); }
+
+    // Pre-Increment/Decrement (++i)
+    bit_iterator& operator++() {
+        if (++_off == bit_word_size) {
+            _off = 0;
+            ++_word;
+        }
+        return *this;
+    }
+    bit_iterator& operator--() {
+        if (!_off--) {
+            _off = bit_word_size - 1;
+            --_word;
+        }
+        return *this;
+    }
+
+    // Post-Increment/Decrement (i++)
+    bit_iterator operator++(int) { bit_iterator copy(*this); ++*this; return copy; }
+    bit_iterator operator--(int) { bit_iterator copy(*this); --*this; return copy; }
+
+    // Arithmetic operators
+    bit_iterator operator+(difference_type n) const { bit_iterator ret(*this); return ret += n; }
+    bit_iterator operator-(difference_type n) const { bit_iterator ret(*this); return ret -= n; }
+    template <class W>
+    difference_type operator-(const bit_iterator<W> &it) const {
+        return (_word - it.word()) * bit_word_size + _off - it.offset();
+    }
+
+    // Arithmetic Assignement operators
+    bit_iterator& operator+=(difference_type n) {
+        difference_type bit = n + _off;
+        difference_type words = bit / bit_word_size;
+        if (bit % bit_word_size < 0)
+            --words;
+        _word += words;
+        _off = static_cast<unsigned>(bit - words * bit_word_size);
+        return *this;
+    }
+    bit_iterator& operator-=(difference_type n) { return *this += -n; }
+
+    // Needed for const comparisons
+    Word *word() const { return _word; }
+    unsigned offset() const { return _off; }
+};
+
+// Outside class definitions //
+
+// const_iterator and iterator comparisons
+template<typename W_L, typename W_R>
+bool operator==(const bit_iterator<W_L> lhs, const bit_iterator<W_R> rhs) {
+    return lhs.word() == rhs.word() && lhs.offset() == rhs.offset();
+}
+
+template<typename W_L, typename W_R>
+bool operator!=(const bit_iterator<W_L> lhs, const bit_iterator<W_R> rhs) {
+    return !(lhs == rhs);
+}
+
+template<typename W_L, typename W_R>
+bool operator<(const bit_iterator<W_L> lhs, const bit_iterator<W_R> rhs) {
+    return lhs - rhs < 0;
+}
+
+template<typename W_L, typename W_R>
+bool operator>(const bit_iterator<W_L> lhs, const bit_iterator<W_R> rhs) {
+    return rhs < lhs;
+}
+
+template<typename W_L, typename W_R>
+bool operator<=(const bit_iterator<W_L> lhs, const bit_iterator<W_R> rhs) {
+    return !(rhs < lhs);
+}
+
+template<typename W_L, typename W_R>
+bool operator>=(const bit_iterator<W_L> lhs, const bit_iterator<W_R> rhs) {
+    return !(lhs < rhs);
+}
+
+// operator+ with difference_type as lhs
+template <class W>
+bit_iterator<W>
+operator+(typename bit_iterator<W>::difference_type n, bit_iterator<W> it) {
+    return it + n;
+}
+
+}
+#endif
@@ -0,0 +1,183 @@
+#ifndef SOA_ITERATOR_HPP
+# define SOA_ITERATOR_HPP
+
+// needed for iterator_traits, remove_const
+# include "../utils/type_traits.hpp"
+// pair, what soa_vector holds
+# include "../utils/pair.hpp"
+
+namespace ft
+{
+
+// ****** soa_reference ******
+// What soa_vector's operator[] and iterators give: its fields live in
+// two arrays, this proxy holds a reference to each, as first and second
+template <class T1, class T2> struct soa_reference
+{
+    typedef typename remove_const<T1>::type     first_type;
+    typedef typename remove_const<T2>::type     second_type;
+
+    T1 &    first;
+    T2 &    second;
+
+    soa_reference(T1 &a, T2 &b): first(a), second(b) {}
+
+    operator pair<first_type, second_type> () const {
+        return pair<first_type, second_type>(first, second);
+    }
+
+    // Assignments write through, to the fields
+    soa_reference& operator=(const pair<first_type, second_type>& x) {
+        first = x.first;
+        second = x.second;
+        return *this;
+    }
+    soa_reference& operator=(const soa_reference& x) {
+        first = x.first;
+        second = x.second;
+        return *this;
+    }
+};
+
+// Compared as pairs, against other references or pairs
+template <class L, class R>
+bool soa_less(const L& lhs, const R& rhs) {
+    return lhs.first < rhs.first || (!(rhs.first < lhs.first) && lhs.second < rhs.second);
+}
+
+template <class L1, class L2, class R1, class R2>
+bool operator==(const soa_reference<L1, L2>& lhs, const soa_reference<R1, R2>& rhs) {
+    return lhs.first == rhs.first && lhs.second == rhs.second;
+}
+
+template <class L1, class L2, class R1, class R2>
+bool operator!=(const soa_reference<L1, L2>& lhs, const soa_reference<R1, R2>& rhs) {
+    return !(lhs == rhs);
+}
+
+template <class L1, class L2, class R1, class R2>
+bool operator<(const soa_reference<L1, L2>& lhs, const soa_reference<R1, R2>& rhs) {
+    return soa_less(lhs, rhs);
+}
+
+template <class L1, class L2, class R1, class R2>
+bool operator<(const soa_reference<L1, L2>& lhs, const pair<R1, R2>& rhs) {
+    return soa_less(lhs, rhs);
+}
+
+template <class L1, class L2, class R1, class R2>
+bool operator<(const pair<L1, L2>& lhs, const soa_reference<R1, R2>& rhs) {
+    return soa_less(lhs, rhs);
+}
+
+// ****** soa_pointer ******
+// What operator-> gives: it->first reads the first array
+template <class T1, class T2> class soa_pointer
+{
+    soa_reference<T1, T2>   _ref;
+
+    public:
+    soa_pointer(const soa_reference<T1, T2>& ref): _ref(ref) {}
+
+    const soa_reference<T1, T2> *operator->() const { return &_ref; }
+};
+
+// ****** soa_iterator ******
+// soa_iterator<T1, T2> is soa_vector::iterator,
+// soa_iterator<const T1, const T2> its const_iterator.
+// One pointer per array, moved together.
+template <class T1, class T2> class soa_iterator
+{
+    public:
+    // iterator_traits
+    typedef pair<typename remove_const<T1>::type,
+                 typename remove_const<T2>::type>   value_type;
+    typedef ptrdiff_t                               difference_type;
+    typedef soa_pointer<T1, T2>                     pointer;
+    typedef soa_reference<T1, T2>                   reference;
+    typedef std::random_access_iterator_tag         iterator_category;
+
+    private:
+    T1 *    _first;     // place in the first array
+    T2 *    _second;    // same place in the second array
+
+    public:
+    // Const conversion
+    operator soa_iterator<const T1, const T2> () const {
+        return (soa_iterator<const T1, const T2>(_first, _second));
+    }
+
+    // Constructors
+    soa_iterator(): _first(NULL), _second(NULL) {}
+    soa_iterator(T1 *first, T2 *second): _first(first), _second(second) {}
+
+    // Member access operators
+    reference operator * () const { return reference(*_first, *_second); }
+    reference operator [] (difference_type n) const { return reference(_first[n], _second[n]); }
+    pointer operator -> () const { return pointer(**this); }
+
+    // Pre-Increment/Decrement (++i)
+    soa_iterator& operator++() { ++_first; ++_second; return *this; }
+    soa_iterator& operator--() { --_first; --_second; return *this; }
+
+    // Post-Increment/Decrement (i++)
+    soa_iterator operator++(int) { soa_iterator copy(*this); ++*this; return copy; }
+    soa_iterator operator--(int) { soa_iterator copy(*this); --*this; return copy; }
+
+    // Arithmetic operators
+    soa_iterator operator+(difference_type n) const { return soa_iterator(_first + n, _second + n); }
+    soa_iterator operator-(difference_type n) const { return soa_iterator(_first - n, _second - n); }
+    template <class U1, class U2>
+    difference_type operator-(const soa_iterator<U1, U2> &it) const { return _first - it.first_base(); }
+
+    // Arithmetic Assignement operators
+    soa_iterator& operator+=(difference_type n) { _first += n; _second += n; return *this; }
+    soa_iterator& operator-=(difference_type n) { _first -= n; _second -= n; return *this; }
+
+    // Needed for const comparisons
+    T1 *first_base() const { return _first; }
+    T2 *second_base() const { return _second; }
+};
+
+// Outside class definitions //
+
+// const_iterator and iterator comparisons, the first array is enough
+template <class L1, class L2, class R1, class R2>
+bool operator==(const soa_iterator<L1, L2> lhs, const soa_iterator<R1, R2> rhs) {
+    return lhs.first_base() == rhs.first_base();
+}
+
+template <class L1, class L2, class R1, class R2>
+bool operator!=(const soa_iterator<L1, L2> lhs, const soa_iterator<R1, R2> rhs) {
+    return lhs.first_base() != rhs.first_base();
+}
+
+template <class L1, class L2, class R1, class R2>
+bool operator<(const soa_iterator<L1, L2> lhs, const soa_iterator<R1, R2> rhs) {
+    return lhs.first_base() < rhs.first_base();
+}
+
+template <class L1, class L2, class R1, class R2>
+bool operator>(const soa_iterator<L1, L2> lhs, const soa_iterator<R1, R2> rhs) {
+    return lhs.first_base() > rhs.first_base();
+}
+
+template <class L1, class L2, class R1, class R2>
+bool operator<=(const soa_iterator<L1, L2> lhs, const soa_iterator<R1, R2> rhs) {
+    return lhs.first_base() <= rhs.first_base();
+}
+
+template <class L1, class L2, class R1, class R2>
+bool operator>=(const soa_iterator<L1, L2> lhs, const soa_iterator<R1, R2> rhs) {
+    return lhs.first_base() >= rhs.first_base();
+}
+
+// operator+ with difference_type as lhs
+template <class T1, class T2>
+soa_iterator<T1, T2>
+operator+(typename soa_iterator<T1, T2>::difference_type n, soa_iterator<T1, T2> it) {
+    return it + n;
+}
+
+}
+#endif
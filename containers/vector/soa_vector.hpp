@@ -0,0 +1,341 @@
+#ifndef SOA_VECTOR_HPP
+# define SOA_VECTOR_HPP
+
+// vector, one per field
+# include "vector.hpp"
+// proxy reference and zip iterator
+# include "soa_iterator.hpp"
+
+namespace ft
+{
+
+/*
+ * soa_vector<T1, T2>: a vector of pair<T1, T2> kept as a structure of
+ * arrays, the firsts in one vector and the seconds in another.
+ *
+ * Same interface as vector<pair<T1, T2> >. operator[] and the
+ * iterators give soa_reference proxies, whose first and second are
+ * references into the two arrays. firsts() and seconds() give the
+ * arrays themselves: a scan of one field reads only that field,
+ * contiguous, with nothing in between.
+ *
+ * Both arrays always have the same size. A modifier that throws
+ * while changing the second one undoes its change to the first.
+ * erase() changes the second one first: when a T2 throws the firsts
+ * are untouched, when a T1 throws the firsts lose their last elements
+ * instead of the erased ones, so the sizes still match.
+*/
+template <class T1, class T2, class Alloc = std::allocator<pair<T1, T2> > >
+class soa_vector
+{
+public:
+
+    /*
+     * **************************************
+     * ********** Member Types **************
+     * **************************************
+    */
+
+    typedef pair<T1, T2>    value_type;
+    typedef T1              first_type;
+    typedef T2              second_type;
+    typedef Alloc           allocator_type;
+
+    typedef soa_reference<T1, T2>               reference;
+    typedef soa_reference<const T1, const T2>   const_reference;
+    typedef soa_pointer<T1, T2>                 pointer;
+    typedef soa_pointer<const T1, const T2>     const_pointer;
+
+    typedef typename allocator_type::size_type       size_type;
+    typedef typename allocator_type::difference_type difference_type;
+
+    /*
+     * **************************************
+     * ********* Iterator Types *************
+     * **************************************
+    */
+
+    typedef soa_iterator<T1, T2>                iterator;
+    typedef soa_iterator<const T1, const T2>    const_iterator;
+
+    typedef ft::reverse_iterator<iterator>          reverse_iterator;
+    typedef ft::reverse_iterator<const_iterator>    const_reverse_iterator;
+
+private:
+
+    typedef typename Alloc::template rebind<T1>::other  first_allocator_type;
+    typedef typename Alloc::template rebind<T2>::other  second_allocator_type;
+
+    /*
+     * **************************************
+     * ************ Variables ***************
+     * **************************************
+    */
+
+    vector<T1, first_allocator_type>    _firsts;
+    vector<T2, second_allocator_type>   _seconds;
+
+    /*
+     * **************************************
+     * ********* Private Functions **********
+     * **************************************
+    */
+
+    // Undoes the insertion of count firsts at pos, when the seconds failed
+    void _rollback_insert(size_type pos, size_type count) {
+        _firsts.erase(_firsts.begin() + pos, _firsts.begin() + pos + count);
+    }
+
+public:
+
+    /*
+     * **************************************
+     * ********* Member Functions ***********
+     * **************************************
+    */
+
+    // ***** Constructors *****
+
+    explicit soa_vector(const allocator_type& alloc = allocator_type()):
+        _firsts(first_allocator_type(alloc)),
+        _seconds(second_allocator_type(alloc)) {}
+
+    // Fill
+    explicit soa_vector(size_type n,
+                        const value_type& val = value_type(),
+                        const allocator_type& alloc = allocator_type()):
+        _firsts(n, val.first, first_allocator_type(alloc)),
+        _seconds(n, val.second, second_allocator_type(alloc)) {}
+
+    // Range
+    template <class InputIt>
+    soa_vector(typename ft::enable_if<!is_integral<InputIt>::value, InputIt>::type first, InputIt last,
+               const allocator_type& alloc = allocator_type()):
+        _firsts(first_allocator_type(alloc)),
+        _seconds(second_allocator_type(alloc))
+    {
+        insert(end(), first, last);
+    }
+
+    // Copy, destructor and operator=: the two vectors'
+
+    /*
+     * **************************************
+     * ************ Iterators ***************
+     * **************************************
+    */
+
+    iterator begin() { return iterator(firsts(), seconds()); }
+    const_iterator begin() const { return const_iterator(firsts(), seconds()); }
+
+    reverse_iterator rbegin() { return reverse_iterator(end()); }
+    const_reverse_iterator rbegin() const { return const_reverse_iterator(end()); }
+
+    iterator end() { return begin() + size(); }
+    const_iterator end() const { return begin() + size(); }
+
+    reverse_iterator rend() { return reverse_iterator(begin()); }
+    const_reverse_iterator rend() const { return const_reverse_iterator(begin()); }
+
+    /*
+     * **************************************
+     * ************* Columns ****************
+     * **************************************
+    */
+
+    // The arrays of each field, size() long
+    T1 *       firsts()        { return _firsts.begin().base(); }
+    const T1 * firsts()  const { return _firsts.begin().base(); }
+    T2 *       seconds()       { return _seconds.begin().base(); }
+    const T2 * seconds() const { return _seconds.begin().base(); }
+
+    /*
+     * **************************************
+     * ************* Capacity ***************
+     * **************************************
+    */
+
+    size_type size() const { return _firsts.size(); }
+
+    size_type max_size() const { return std::min(_firsts.max_size(), _seconds.max_size()); }
+
+    size_type capacity() const { return _firsts.capacity(); }
+
+    bool empty() const { return _firsts.empty(); }
+
+    void resize (size_type n, value_type val = value_type()) {
+        if (n < size())
+            erase(begin() + n, end());
+        else
+            insert(end(), n - size(), val);
+    }
+
+    void reserve(size_type n){
+        _firsts.reserve(n);
+        _seconds.reserve(n);
+    }
+
+    void shrink_to_fit() {
+        _firsts.shrink_to_fit();
+        _seconds.shrink_to_fit();
+    }
+
+    /*
+     * **************************************
+     * ********** Element Access ************
+     * **************************************
+    */
+
+    allocator_type get_allocator() const { return allocator_type(_firsts.get_allocator()); }
+
+    reference       operator[](size_type pos)       { return begin()[pos]; }
+    const_reference operator[](size_type pos) const { return begin()[pos]; }
+
+    // the range check of the firsts
+    reference       at(size_type pos)       { _firsts.at(pos); return (*this)[pos]; }
+    const_reference at(size_type pos) const { _firsts.at(pos); return (*this)[pos]; }
+
+    reference       front()       { return *begin(); }
+    const_reference front() const { return *begin(); }
+
+    reference       back()       { return *(end() - 1); }
+    const_reference back() const { return *(end() - 1); }
+
+    /*
+     * **************************************
+     * ************ Modifiers ***************
+     * **************************************
+    */
+
+    void push_back (const value_type& val){ push_back(val.first, val.second); }
+
+    void push_back (const T1& first, const T2& second){
+        _firsts.push_back(first);
+        try { _seconds.push_back(second); }
+        catch (...) { _firsts.pop_back(); throw; }
+    }
+
+    void pop_back() {
+        _firsts.pop_back();
+        _seconds.pop_back();
+    }
+
+    // Inserts value before pos
+    iterator insert( iterator pos, const value_type& value ) {
+        size_type goal = pos - begin();
+        insert(pos, 1, value);
+        return begin() + goal;
+    }
+
+    // Inserts count copies of the value before pos
+    void insert( iterator pos, size_type count, const value_type& value ) {
+        size_type goal = pos - begin();
+
+        _firsts.insert(_firsts.begin() + goal, count, value.first);
+        try { _seconds.insert(_seconds.begin() + goal, count, value.second); }
+        catch (...) { _rollback_insert(goal, count); throw; }
+    }
+
+    // The range is read once, split in two columns, then each inserted
+    template <class InputIt>
+    void insert(iterator pos,
+                typename ft::enable_if<!is_integral<InputIt>::value, InputIt>::type first,
+                InputIt last)
+    {
+        size_type goal = pos - begin();
+        vector<T1, first_allocator_type>    f(_firsts.get_allocator());
+        vector<T2, second_allocator_type>   s(_seconds.get_allocator());
+
+        for (; first != last; ++first) {
+            f.push_back((*first).first);
+            s.push_back((*first).second);
+        }
+        _firsts.insert(_firsts.begin() + goal, f.begin(), f.end());
+        try { _seconds.insert(_seconds.begin() + goal, s.begin(), s.end()); }
+        catch (...) { _rollback_insert(goal, f.size()); throw; }
+    }
+
+    void assign( size_type count, const value_type& value ) {
+        clear();
+        insert(end(), count, value);
+    }
+
+    template< class InputIt >
+    void assign( typename ft::enable_if<!is_integral<InputIt>::value, InputIt>::type first, InputIt last )
+    {
+        clear();
+        insert(end(), first, last);
+    }
+
+    iterator erase( iterator pos ) { return erase(pos, pos + 1); }
+
+    iterator erase( iterator first, iterator last) {
+        size_type goal = first - begin();
+        size_type range = last - first;
+
+        _seconds.erase(_seconds.begin() + goal, _seconds.begin() + goal + range);
+        try { _firsts.erase(_firsts.begin() + goal, _firsts.begin() + goal + range); }
+        catch (...) { _firsts.erase(_firsts.end() - range, _firsts.end()); throw; }
+        return begin() + goal;
+    }
+
+    void swap(soa_vector &x) {
+        _firsts.swap(x._firsts);
+        _seconds.swap(x._seconds);
+    }
+
+    void clear() {
+        _firsts.clear();
+        _seconds.clear();
+    }
+};
+
+/*
+ * **************************************
+ * ********** Relational Ope ************
+ * **************************************
+*/
+
+// equality, a column at a time
+template <class T1, class T2, class Alloc>
+bool operator==(const soa_vector<T1, T2, Alloc>& lhs,
+                const soa_vector<T1, T2, Alloc>& rhs) {
+    return lhs.size() == rhs.size()
+        && ft::equal(lhs.firsts(), lhs.firsts() + lhs.size(), rhs.firsts())
+        && ft::equal(lhs.seconds(), lhs.seconds() + lhs.size(), rhs.seconds());
+}
+
+template <class T1, class T2, class Alloc>
+bool operator!=(const soa_vector<T1, T2, Alloc>& lhs,
+                const soa_vector<T1, T2, Alloc>& rhs) {
+    return !(lhs == rhs);
+}
+
+template <class T1, class T2, class Alloc>
+bool operator<(const soa_vector<T1, T2, Alloc>& lhs,
+                const soa_vector<T1, T2, Alloc>& rhs) {
+    return ft::lexicographical_compare(lhs.begin(), lhs.end(),
+                                        rhs.begin(), rhs.end());
+}
+
+template <class T1, class T2, class Alloc>
+bool operator>(const soa_vector<T1, T2, Alloc>& lhs,
+                const soa_vector<T1, T2, Alloc>& rhs) {
+    return rhs < lhs;
+}
+
+template <class T1, class T2, class Alloc>
+bool operator<=(const soa_vector<T1, T2, Alloc>& lhs,
+                const soa_vector<T1, T2, Alloc>& rhs) {
+    return !(rhs < lhs);
+}
+
+template <class T1, class T2, class Alloc>
+bool operator>=(const soa_vector<T1, T2, Alloc>& lhs,
+                const soa_vector<T1, T2, Alloc>& rhs) {
+    return !(lhs < rhs);
+}
+
+}
+
+#endif
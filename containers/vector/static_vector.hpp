@@ -0,0 +1,379 @@
+#ifndef STATIC_VECTOR_HPP
+# define STATIC_VECTOR_HPP
+
+# include <new>         // needed for placement new
+# include <stdexcept>   // needed for length_error, out_of_range
+# include <algorithm>   // needed for std::rotate, std::copy
+
+// type_traits, contains iterator_traits, enable_if, is_integral
+# include "../utils/type_traits.hpp"
+// comparisons, contains equal and lexicographical_compare
+# include "../utils/comparisons.hpp"
+// iterators, contains reverse_iterator
+# include "../utils/iterators.hpp"
+// iterators, specific to vec
+# include "vec_iterator.hpp"
+
+namespace ft
+{
+
+/*
+ * static_vector<T, N>: a vector of at most N elements, kept inside the
+ * object itself. Nothing is allocated: a static_vector on the stack
+ * has its elements on the stack.
+ *
+ * Same interface and iterators as vector. Capacity is always N, and
+ * anything that would go over it throws length_error, leaving the
+ * static_vector as it was. Except for two, which leave it valid:
+ * assign() from input iterators, whose old elements are gone before
+ * the range can be counted, and swap(), which can stop halfway.
+*/
+template <class T, std::size_t N> class static_vector
+{
+public:
+
+    /*
+     * **************************************
+     * ********** Member Types **************
+     * **************************************
+    */
+
+    typedef T                   value_type;
+    typedef T&                  reference;
+    typedef const T&            const_reference;
+    typedef T*                  pointer;
+    typedef const T*            const_pointer;
+
+    typedef std::size_t         size_type;
+    typedef std::ptrdiff_t      difference_type;
+
+    /*
+     * **************************************
+     * ********* Iterator Types *************
+     * **************************************
+    */
+
+    typedef vec_iterator<T>         iterator;
+    typedef vec_iterator<const T>   const_iterator;
+
+    typedef ft::reverse_iterator<iterator>          reverse_iterator;
+    typedef ft::reverse_iterator<const_iterator>    const_reverse_iterator;
+
+private:
+
+    /*
+     * **************************************
+     * ************ Variables ***************
+     * **************************************
+    */
+
+    // Room for N elements, aligned for any of them
+    union {
+        char        _buf[N ? N * sizeof(T) : 1];
+        long double _align_ld;
+        long long   _align_ll;
+        void *      _align_p;
+    };
+    size_type   _sz;    // this.size()
+
+    /*
+     * **************************************
+     * ********* Private Functions **********
+     * **************************************
+    */
+
+    T *       _ar()       { return reinterpret_cast<T *>(_buf); }
+    const T * _ar() const { return reinterpret_cast<const T *>(_buf); }
+
+    // Throws when n more elements wouldn't fit
+    void _check_room(size_type n, const char *where) const {
+        if (n > N - _sz)
+            throw std::length_error(where);
+    }
+
+    // Destroys the elements from n to size()
+    void _destroy_from(size_type n) {
+        while (_sz > n)
+            _ar()[--_sz].~T();
+    }
+
+public:
+
+    /*
+     * **************************************
+     * ********* Member Functions ***********
+     * **************************************
+    */
+
+    // ***** Constructors *****
+
+    static_vector(): _sz(0) {}
+
+    // Fill
+    explicit static_vector(size_type n, const value_type& val = value_type()): _sz(0) {
+        assign(n, val);
+    }
+
+    // Range
+    template <class InputIt>
+    static_vector(typename ft::enable_if<!is_integral<InputIt>::value, InputIt>::type first, InputIt last):
+        _sz(0)
+    {
+        try { assign(first, last); }
+        catch (...) { clear(); throw; }
+    }
+
+    // Copy
+    static_vector(const static_vector& cpy): _sz(0) {
+        try { insert(end(), cpy.begin(), cpy.end()); }
+        catch (...) { clear(); throw; }
+    }
+
+    // ***** Destructor *****
+    ~static_vector() { clear(); }
+
+    // ***** Assignment operator *****
+    // the elements both have are assigned, the others made or destroyed
+    static_vector& operator=(const static_vector& cpy) {
+        if (&cpy == this)
+            return *this;
+        if (cpy._sz < _sz)
+            _destroy_from(cpy._sz);
+        std::copy(cpy.begin(), cpy.begin() + _sz, begin());
+        insert(end(), cpy.begin() + _sz, cpy.end());
+        return *this;
+    }
+
+    /*
+     * **************************************
+     * ************ Iterators ***************
+     * **************************************
+    */
+
+    iterator begin() { return iterator(_ar()); }
+    const_iterator begin() const { return const_iterator(_ar()); }
+
+    reverse_iterator rbegin() { return reverse_iterator(end()); }
+    const_reverse_iterator rbegin() const { return const_reverse_iterator(end()); }
+
+    iterator end() { return iterator(_ar() + _sz); }
+    const_iterator end() const { return const_iterator(_ar() + _sz); }
+
+    reverse_iterator rend() { return reverse_iterator(begin()); }
+    const_reverse_iterator rend() const { return const_reverse_iterator(begin()); }
+
+    /*
+     * **************************************
+     * ************* Capacity ***************
+     * **************************************
+    */
+
+    size_type size() const { return _sz; }
+
+    size_type max_size() const { return N; }
+
+    size_type capacity() const { return N; }
+
+    bool empty() const { return !_sz; }
+
+    bool full() const { return _sz == N; }
+
+    void resize (size_type n, value_type val = value_type()) {
+        if (n < _sz)
+            _destroy_from(n);
+        else
+            insert(end(), n - _sz, val);
+    }
+
+    void reserve(size_type n) {
+        if (n > N)
+            throw std::length_error("static_vector::reserve");
+    }
+
+    /*
+     * **************************************
+     * ********** Element Access ************
+     * **************************************
+    */
+
+    reference       operator[](size_type pos)       { return _ar()[pos]; }
+    const_reference operator[](size_type pos) const { return _ar()[pos]; }
+
+    reference       at(size_type pos) {
+        if (pos >= _sz)
+            throw std::out_of_range("static_vector::at");
+        return _ar()[pos];
+    }
+    const_reference at(size_type pos) const {
+        if (pos >= _sz)
+            throw std::out_of_range("static_vector::at");
+        return _ar()[pos];
+    }
+
+    reference       front()       { return _ar()[0]; }
+    const_reference front() const { return _ar()[0]; }
+
+    reference       back()       { return _ar()[_sz - 1]; }
+    const_reference back() const { return _ar()[_sz - 1]; }
+
+    /*
+     * **************************************
+     * ************ Modifiers ***************
+     * **************************************
+    */
+
+    void push_back (const value_type& val){
+        _check_room(1, "static_vector::push_back");
+        new (_ar() + _sz) T(val);
+        ++_sz;
+    }
+
+    void pop_back() { _ar()[--_sz].~T(); }
+
+    // Inserts value before pos
+    iterator insert( iterator pos, const value_type& value ) {
+        size_type goal = pos - begin();
+        insert(pos, 1, value);
+        return begin() + goal;
+    }
+
+    // New elements are made at the end, then rotated into place:
+    // there is no uninitialized gap to fill halfway through
+    void insert( iterator pos, size_type count, const value_type& value ) {
+        size_type goal = pos - begin();
+        size_type old_sz = _sz;
+
+        _check_room(count, "static_vector::insert");
+        try {
+            while (count--)
+                push_back(value);
+        }
+        catch (...) { _destroy_from(old_sz); throw; }
+        std::rotate(begin() + goal, begin() + old_sz, end());
+    }
+
+    // Also for input iterators: push_back checks the room one at a time
+    template <class InputIt>
+    void insert(iterator pos,
+                typename ft::enable_if<!is_integral<InputIt>::value, InputIt>::type first,
+                InputIt last)
+    {
+        size_type goal = pos - begin();
+        size_type old_sz = _sz;
+
+        try {
+            for (; first != last; ++first)
+                push_back(*first);
+        }
+        catch (...) { _destroy_from(old_sz); throw; }
+        std::rotate(begin() + goal, begin() + old_sz, end());
+    }
+
+    void assign( size_type count, const value_type& value ) {
+        if (count > N)
+            throw std::length_error("static_vector::assign");
+        clear();
+        insert(end(), count, value);
+    }
+
+    template< class InputIt >
+    void assign( typename ft::enable_if<!is_integral<InputIt>::value, InputIt>::type first, InputIt last )
+    {
+        _assign_pv(first, last,
+                  typename iterator_traits<InputIt>::iterator_category());
+    }
+
+private:
+    // read once: the old elements go before the range is known
+    template <class InputIt>
+    void _assign_pv(InputIt first, InputIt last, std::input_iterator_tag) {
+        clear();
+        insert(end(), first, last);
+    }
+
+    // counted first: too long a range leaves the elements as they were
+    template <class InputIt>
+    void _assign_pv(InputIt first, InputIt last, std::forward_iterator_tag) {
+        size_type n = 0;
+        for (InputIt it = first; it != last; ++it)
+            ++n;
+        if (n > N)
+            throw std::length_error("static_vector::assign");
+        clear();
+        insert(end(), first, last);
+    }
+
+public:
+
+    iterator erase( iterator pos ) { return erase(pos, pos + 1); }
+
+    iterator erase( iterator first, iterator last) {
+        size_type goal = first - begin();
+
+        std::copy(last, end(), first);
+        _destroy_from(_sz - (last - first));
+        return begin() + goal;
+    }
+
+    // Element by element: the elements live in the objects.
+    // A throwing copy leaves both valid, but only partly swapped
+    void swap(static_vector &x) {
+        static_vector & big = _sz < x._sz ? x : *this;
+        static_vector & small = _sz < x._sz ? *this : x;
+        size_type common = small._sz;
+
+        for (size_type i = 0; i < common; ++i)
+            std::swap(_ar()[i], x._ar()[i]);
+        small.insert(small.end(), big.begin() + common, big.end());
+        big._destroy_from(common);
+    }
+
+    void clear() { _destroy_from(0); }
+};
+
+/*
+ * **************************************
+ * ********** Relational Ope ************
+ * **************************************
+*/
+
+template <class T, std::size_t N>
+bool operator==(const static_vector<T, N>& lhs,
+                const static_vector<T, N>& rhs) {
+    return lhs.size() == rhs.size() && ft::equal(lhs.begin(), lhs.end(), rhs.begin());
+}
+
+template <class T, std::size_t N>
+bool operator!=(const static_vector<T, N>& lhs,
+                const static_vector<T, N>& rhs) {
+    return !(lhs == rhs);
+}
+
+template <class T, std::size_t N>
+bool operator<(const static_vector<T, N>& lhs,
+                const static_vector<T, N>& rhs) {
+    return ft::lexicographical_compare(lhs.begin(), lhs.end(),
+                                        rhs.begin(), rhs.end());
+}
+
+template <class T, std::size_t N>
+bool operator>(const static_vector<T, N>& lhs,
+                const static_vector<T, N>& rhs) {
+    return rhs < lhs;
+}
+
+template <class T, std::size_t N>
+bool operator<=(const static_vector<T, N>& lhs,
+                const static_vector<T, N>& rhs) {
+    return !(rhs < lhs);
+}
+
+template <class T, std::size_t N>
+bool operator>=(const static_vector<T, N>& lhs,
+                const static_vector<T, N>& rhs) {
+    return !(lhs < rhs);
+}
+
+}
+
+#endif
@@ -3,6 +3,7 @@
 
 # include <memory> // needed for std::allocator
 # include <limits> // needed for vector::max_size()
+# include <cstring> // needed for memcpy
 
 // type_traits, contains iterator_traits, enable_if, is_integral
 # include "../utils/type_traits.hpp"
@@ -10,6 +11,8 @@
 # include "../utils/comparisons.hpp"
 // iterators, contains reverse_iterator
 # include "../utils/iterators.hpp"
+// pair, contains compressed_pair
+# include "../utils/pair.hpp"
 // iterators, specific to vec
 # include "vec_iterator.hpp"
 
@@ -25,6 +28,18 @@
 namespace ft
 {
 
+// ****** vector_shrink_policy ******
+// Automatic shrink policy, disabled by default.
+// Specialize it for a value type to let ft::vector<T> give memory back
+// after a burst: once size drops below a quarter of the capacity,
+// the capacity is halved (the gap between the two thresholds avoids
+// reallocating back and forth around a single size).
+// Capacity is never shrunk under min_capacity.
+template <class T> struct vector_shrink_policy {
+    static const bool           enabled = false;
+    static const std::size_t    min_capacity = 16;
+};
+
 template <class T, class Alloc = std::allocator<T> > class vector
 {
 public:
@@ -68,10 +83,10 @@ private:
      * **************************************
     */
 
-    allocator_type  _al;    // Allocator
+    // Allocator and this.capacity(), an empty allocator takes no space
+    ft::compressed_pair<allocator_type, size_type>  _al_cp;
     pointer         _ar;    // Underlying array
     size_type       _sz;    // this.size()
-    size_type       _cp;    // this.capacity()
 
     /*
      * **************************************
@@ -81,26 +96,51 @@ private:
      * These are used to avoid rewriting code
     */
 
+    allocator_type&       _alloc()       { return _al_cp.first(); }
+    const allocator_type& _alloc() const { return _al_cp.first(); }
+    size_type&            _cap()         { return _al_cp.second(); }
+    const size_type&      _cap()   const { return _al_cp.second(); }
+
     // Destroys and deallocate all vector content
     void empty_self() {
         for (unsigned int i = 0; i < _sz; i++)
-            _al.destroy(_ar + i);
-        if (_cp)
-            _al.deallocate(_ar, _cp);
+            _alloc().destroy(_ar + i);
+        if (_cap())
+            _alloc().deallocate(_ar, _cap());
+    }
+
+    // Moves n elements from src to the raw memory at dst, src is left raw
+    void _relocate(pointer dst, pointer src, size_type n) {
+        if (is_trivially_relocatable<T>::value) {
+            if (n)
+                std::memcpy(static_cast<void *>(dst), static_cast<void *>(src), n * sizeof(T));
+            return;
+        }
+        for (size_type i = 0; i < n; i++)
+            _alloc().construct(dst + i, *(src + i));
+        for (size_type i = 0; i < n; i++)
+            _alloc().destroy(src + i);
     }
 
     void realloc_self(size_type new_cp) {
         pointer old_ar = _ar;
 
-        _ar = _al.allocate(new_cp);
-        for (size_type i = 0; i < _sz; i++)
-            _al.construct(_ar + i, *(old_ar + i));
+        _ar = _alloc().allocate(new_cp);
+        _relocate(_ar, old_ar, _sz);
+        _alloc().deallocate(old_ar, _cap());
 
-        for (size_type i = 0; i < _sz; i++)
-            _al.destroy(old_ar + i);
-        _al.deallocate(old_ar, _cp);
+        _cap() = new_cp;
+    }
 
-        _cp = new_cp;
+    // Called after elements are removed, applies vector_shrink_policy
+    void _auto_shrink() {
+        if (!vector_shrink_policy<T>::enabled)
+            return;
+        size_type new_cp = _cap();
+        while (new_cp / 2 >= vector_shrink_policy<T>::min_capacity && _sz < new_cp / 4)
+            new_cp /= 2;
+        if (new_cp != _cap())
+            realloc_self(new_cp);
     }
 
     template <class Ite>
@@ -125,8 +165,8 @@ public:
 
     // Constructs an empty container with the given allocator alloc
     explicit vector(const allocator_type& alloc = allocator_type()):
-        _al(alloc),
-        _ar(0), _sz(0), _cp(0){}
+        _al_cp(alloc, 0),
+        _ar(0), _sz(0){}
 
     // Fill
     // Constructs a container with n elements.
@@ -134,17 +174,16 @@ public:
     explicit vector(size_type n,
                     const value_type& val = value_type(),
                     const allocator_type& alloc = allocator_type()):
-        _al(alloc),
+        _al_cp(alloc, n),
         _ar(0),
-        _sz(n),
-        _cp(n)
+        _sz(n)
     {
         if (n)
-            _ar = _al.allocate(n);
+            _ar = _alloc().allocate(n);
         else
             _ar = 0;
         for (unsigned int i = 0; i < _sz; i++)
-            _al.construct(_ar + i, val);
+            _alloc().construct(_ar + i, val);
     }
 
     // Range:
@@ -154,20 +193,18 @@ public:
     template <class InputIt>
     vector(typename ft::enable_if<!is_integral<InputIt>::value, InputIt>::type first, InputIt last,
             const allocator_type& alloc = allocator_type()):
-        _al(alloc),
+        _al_cp(alloc, 0),
         _ar(0),
-        _sz(0),
-        _cp(0)
+        _sz(0)
     {
         insert(end(), first, last);
     }
 
     // Copy:
     vector (const vector& cpy):
-        _al(allocator_type()),
+        _al_cp(allocator_type(), 0),
         _ar(0),
-        _sz(0),
-        _cp(0)
+        _sz(0)
     {
         assign(cpy.begin(), cpy.end());
     }
@@ -214,7 +251,7 @@ public:
         return std::numeric_limits<difference_type>::max() / (sizeof(value_type) / 2 < 1 ? 1 : sizeof(value_type) / 2);
     }
 
-    size_type capacity() const { return _cp; }
+    size_type capacity() const { return _cap(); }
 
     bool empty() const { return !_sz  ? true : false; }
 
@@ -226,20 +263,34 @@ public:
     void resize (size_type n, value_type val = value_type()) {
         if (n < _sz)
             for (size_type i = n; i < _sz; i++)
-                _al.destroy(_ar + i);
+                _alloc().destroy(_ar + i);
         else if (_sz < n)
             insert(end(), n - _sz, val);
         _sz = n;
+        _auto_shrink();
     }
 
 
     void reserve(size_type n){
         if (n > max_size())
             throw std::length_error("vector::reserve");
-        if (n > _cp)
+        if (n > _cap())
             realloc_self(n);
     }
 
+    // Reduces capacity to size, releasing the whole array if empty
+    void shrink_to_fit() {
+        if (_sz == _cap())
+            return;
+        if (!_sz) {
+            _alloc().deallocate(_ar, _cap());
+            _ar = 0;
+            _cap() = 0;
+        }
+        else
+            realloc_self(_sz);
+    }
+
 
     /*
      * **************************************
@@ -248,7 +299,7 @@ public:
     */
 
     // Get allocator
-    allocator_type get_allocator() const { return _al;}
+    allocator_type get_allocator() const { return _alloc();}
 
     // [] operator
     reference       operator[](size_type pos)       { return *(_ar + pos);}
@@ -281,36 +332,34 @@ public:
 
     // Push back
     void push_back (const value_type& val){
-        if (_sz >= _cp) {
+        if (_sz >= _cap()) {
             pointer old_ar = _ar;
-            _ar = _al.allocate(NEWCP);
-            for (size_type i = 0; i < _sz; i++)
-                _al.construct(_ar + i, *(old_ar + i));
-            _al.construct(_ar + _sz, val);
-            for (size_type i = 0; i < _sz; i++)
-                _al.destroy(old_ar + i);
+            _ar = _alloc().allocate(NEWCP);
+            // val may be one of the old elements: it is copied first
+            _alloc().construct(_ar + _sz, val);
+            _relocate(_ar, old_ar, _sz);
             if (old_ar)
-                _al.deallocate(old_ar, _cp);
-            _cp = NEWCP;
+                _alloc().deallocate(old_ar, _cap());
+            _cap() = NEWCP;
         }
         else
-            _al.construct(_ar + _sz, val);
+            _alloc().construct(_ar + _sz, val);
         ++_sz;
     }
 
     // Pop Back
-    void pop_back() { _al.destroy(_ar + --_sz); }
+    void pop_back() { _alloc().destroy(_ar + --_sz); _auto_shrink(); }
 
 
     // Inserts value before pos
     iterator insert( iterator pos, const T& value ) {
         size_type goal = pos - begin();
 
-        if (!_sz && _cp)
-            _al.construct(_ar + goal, value);
-        else if (_sz < _cp) {
+        if (!_sz && _cap())
+            _alloc().construct(_ar + goal, value);
+        else if (_sz < _cap()) {
             size_type i = _sz;
-            _al.construct(_ar + i, *(_ar + i - 1));
+            _alloc().construct(_ar + i, *(_ar + i - 1));
             i--;
             while (i > goal) {
                 *(_ar + i) = *(_ar + i - 1);
@@ -320,22 +369,22 @@ public:
         }
         else {
             pointer xar = _ar;
-            _ar = _al.allocate(NEWCP);
+            _ar = _alloc().allocate(NEWCP);
             size_type i = 0;
             while (i < goal) {
-                _al.construct(_ar + i, *(xar + i));
+                _alloc().construct(_ar + i, *(xar + i));
                 i++;
             }
-            _al.construct(_ar + i, value);
+            _alloc().construct(_ar + i, value);
             while (i < _sz) {
-                 _al.construct(_ar + i + 1, *(xar + i));
+                 _alloc().construct(_ar + i + 1, *(xar + i));
                  i++;
             }
             while (i > 0)
-                _al.destroy(xar + --i);
-            if (_cp)
-                _al.deallocate(xar, _cp);
-            _cp = NEWCP;
+                _alloc().destroy(xar + --i);
+            if (_cap())
+                _alloc().deallocate(xar, _cap());
+            _cap() = NEWCP;
         }
         _sz++;
         return iterator(_ar + goal);
@@ -347,13 +396,13 @@ public:
         if (count == 1)
             return (void) insert(pos, value);
         size_type new_sz = _sz + count;
-        if (!_sz && _cp)
+        if (!_sz && new_sz <= _cap())
         {
             size_type i = 0;
             while (i < new_sz)
-               _al.construct(_ar + i++, value);
+               _alloc().construct(_ar + i++, value);
         }
-        else if (new_sz < _cp)
+        else if (new_sz < _cap())
             _insert_count_noalloc(pos, count, value);
         else
             _insert_count_realloc(pos, count, value);
@@ -366,12 +415,13 @@ private:
         size_type goal = pos - begin();
         size_type new_sz = _sz + count;
         size_type i = 1;
-        while (new_sz - i >= _sz && _sz - i >= goal) {
-            _al.construct(_ar + new_sz - i, _ar[_sz - i]);
+        // bounds on i: _sz - i and new_sz - i can wrap around
+        while (new_sz - i >= _sz && i <= _sz - goal) {
+            _alloc().construct(_ar + new_sz - i, _ar[_sz - i]);
             ++i;
         }
-        while (new_sz - i >= _sz) {
-            _al.construct(_ar + new_sz - i, value);
+        while (i <= count) {
+            _alloc().construct(_ar + new_sz - i, value);
             ++i;
         }
         while (new_sz - i >= goal && new_sz - i >= goal + count) {
@@ -394,22 +444,22 @@ private:
         size_type new_sz = _sz + count;
         size_type i = 0;
         pointer old_ar = _ar;
-        _ar = _al.allocate(std::max(NEWCP, new_sz));
+        _ar = _alloc().allocate(std::max(NEWCP, new_sz));
         while (i < goal) {
-            _al.construct(_ar + i, *(old_ar + i));
+            _alloc().construct(_ar + i, *(old_ar + i));
             i++;
         }
         while (i < goal + count)
-            _al.construct(_ar + i++, value);
+            _alloc().construct(_ar + i++, value);
         while (i < new_sz) {
-            _al.construct(_ar + i, *(old_ar + i - count));
+            _alloc().construct(_ar + i, *(old_ar + i - count));
             i++;
         }
         for (i = 0; i < _sz; i++)
-            _al.destroy(old_ar + i);
-        if (_cp)
-            _al.deallocate(old_ar, _cp);
-        _cp = std::max( NEWCP, new_sz);
+            _alloc().destroy(old_ar + i);
+        if (_cap())
+            _alloc().deallocate(old_ar, _cap());
+        _cap() = std::max( NEWCP, new_sz);
     }
 
 public:
@@ -434,7 +484,7 @@ private:
     // this is bcause input_iterators can only be read and incremented once
     template <class InputIt>
     void _insert_pv(iterator pos, InputIt first, InputIt last, std::input_iterator_tag) {
-        if (!_cp)
+        if (!_cap())
             while (first != last) {
                 pos = insert(pos, *first);
                 ++first;
@@ -454,15 +504,16 @@ private:
         size_type new_sz = _sz + range;
         size_type i = 1;
 
-        while (new_sz - i >= _sz && _sz - i >= goal) {
-            _al.construct(_ar + new_sz - i, *(_ar +_sz - i));
+        // bounds on i: _sz - i and new_sz - i can wrap around
+        while (i <= range && i <= _sz - goal) {
+            _alloc().construct(_ar + new_sz - i, *(_ar +_sz - i));
             ++i;
         }
-        while (new_sz - i >= _sz) {
-            _al.construct(_ar + new_sz - i, value_type());
+        while (i <= range) {
+            _alloc().construct(_ar + new_sz - i, value_type());
             ++i;
         }
-        while (new_sz - i >= goal + range) {
+        while (i <= _sz - goal) {
             _ar[new_sz - i] = *(_ar + _sz - i);
             ++i;
         }
@@ -479,22 +530,22 @@ private:
         size_type i = 0;
         pointer old_ar = _ar;
 
-        _ar = _al.allocate(std::max(NEWCP, new_sz));
+        _ar = _alloc().allocate(std::max(NEWCP, new_sz));
         while (i < goal) {
-            _al.construct(_ar + i, *(old_ar + i));
+            _alloc().construct(_ar + i, *(old_ar + i));
             i++;
         }
         while (i < goal + range)
-            _al.construct(_ar + i++, *first++);
+            _alloc().construct(_ar + i++, *first++);
         while (i < new_sz) {
-            _al.construct(_ar + i, *(old_ar + i - range));
+            _alloc().construct(_ar + i, *(old_ar + i - range));
             i++;
         }
         for (i = 0; i < _sz; i++)
-            _al.destroy(old_ar + i);
-        if (_cp)
-            _al.deallocate(old_ar, _cp);
-        _cp = std::max(NEWCP, new_sz);
+            _alloc().destroy(old_ar + i);
+        if (_cap())
+            _alloc().deallocate(old_ar, _cap());
+        _cap() = std::max(NEWCP, new_sz);
 }
 
     // if InputIt is at least a forward_iterator, optimization is possible,
@@ -506,7 +557,7 @@ private:
 
         if (range == 0)
             return;
-        if (new_sz < _cp)
+        if (new_sz < _cap())
             _insert_input_noalloc(pos, first, last);
         else
             _insert_input_realloc(pos, first, last);
@@ -520,12 +571,12 @@ public:
     // does the equivalent of rebuilding the vector with vector(count, value)
     // (but optimized to reuse previously constructed elements)
     void assign( size_type count, const T& value ) {
-        if (count > _cp) {
-            pointer next = _al.allocate(count);
+        if (count > _cap()) {
+            pointer next = _alloc().allocate(count);
             for (size_type i = 0; i < count; i++)
-                _al.construct(next + i, value);
+                _alloc().construct(next + i, value);
             empty_self();
-            _cp = count;
+            _cap() = count;
             _ar = next;
         }
         else {
@@ -533,10 +584,10 @@ public:
                 *(_ar + i) = value;
             if (_sz > count)
                 while (count != _sz)
-                    _al.destroy(_ar + --_sz);
+                    _alloc().destroy(_ar + --_sz);
             else
                 while (count != _sz)
-                    _al.construct(_ar + _sz++, value);
+                    _alloc().construct(_ar + _sz++, value);
         }
         _sz = count;
     }
@@ -557,7 +608,7 @@ private:
             *(_ar + i++) = *first++;
         if (first == last){
             while (i < _sz)
-                _al.destroy(_ar + --_sz);
+                _alloc().destroy(_ar + --_sz);
         }
         else while (first != last)
             insert(end(), *first++);
@@ -566,12 +617,12 @@ private:
     template <class InputIt>
     void _assign_pv(InputIt first, InputIt last, std::forward_iterator_tag) {
         size_type new_sz = _range(first, last);
-        if (new_sz > _cp) {
-            pointer next = _al.allocate(new_sz);
+        if (new_sz > _cap()) {
+            pointer next = _alloc().allocate(new_sz);
             for (size_type i = 0; i < new_sz; i++)
-                _al.construct(next + i, *first++);
+                _alloc().construct(next + i, *first++);
             empty_self();
-            _cp = new_sz;
+            _cap() = new_sz;
             _ar = next;
         }
         else {
@@ -579,10 +630,10 @@ private:
                 *(_ar + i) = *first++;
             if (_sz > new_sz)
                 while (new_sz != _sz)
-                    _al.destroy(_ar + --_sz);
+                    _alloc().destroy(_ar + --_sz);
             else
                 while (new_sz != _sz)
-                    _al.construct(_ar + _sz++, *first++);
+                    _alloc().construct(_ar + _sz++, *first++);
         }
         _sz = new_sz;
     }
@@ -591,49 +642,53 @@ private:
 public:
     // removes the element at pos
     iterator erase( iterator pos ) {
-        size_type ptr = pos - begin();
+        size_type goal = pos - begin();
+        size_type ptr = goal;
         while (ptr < _sz - 1) {
             *(_ar + ptr) = *(_ar + ptr + 1);
             ptr++;
         }
-        _al.destroy(_ar + --_sz);
-        return pos;
+        _alloc().destroy(_ar + --_sz);
+        _auto_shrink();
+        return begin() + goal;
     }
 
     // removes the elements in range [first, last)
     iterator erase( iterator first, iterator last) {
         size_type range = last - first;
-        iterator  first_cpy = first;
+        size_type goal = first - begin();
         while (last != end()) {
             *first = *last;
             ++first;
             ++last;
         }
         while (range) {
-            _al.destroy(_ar + --_sz);
+            _alloc().destroy(_ar + --_sz);
             --range;
         }
-        return first_cpy;
+        _auto_shrink();
+        return begin() + goal;
     }
 
     void swap(vector &x) {
         pointer    tmp_ar = x._ar;
         size_type  tmp_sz = x._sz;
-        size_type  tmp_cp = x._cp;
+        size_type  tmp_cp = x._cap();
 
         x._ar = _ar;
         x._sz = _sz;
-        x._cp = _cp;
+        x._cap() = _cap();
 
         _ar = tmp_ar;
         _sz = tmp_sz;
-        _cp = tmp_cp;
+        _cap() = tmp_cp;
     }
 
     void clear() {
         for (size_type i = 0; i < _sz; i++)
-            _al.destroy(_ar + i);
+            _alloc().destroy(_ar + i);
         _sz = 0;
+        _auto_shrink();
     }
 
 
@@ -694,4 +749,8 @@ bool operator>=(const vector<T, Alloc>& lhs,
 }
 
 # undef NEWCP
+
+// vector<bool>, one bit per element
+# include "vector_bool.hpp"
+
 #endif
@@ -0,0 +1,528 @@
+#ifndef VECTOR_BOOL_HPP
+# define VECTOR_BOOL_HPP
+
+// Included at the end of vector.hpp, after the primary template
+
+# include <cstring> // needed for memset, memcpy and memcmp
+
+// bit_reference and iterators, specific to vector<bool>
+# include "bit_iterator.hpp"
+
+namespace ft
+{
+
+/*
+ * vector<bool>: one bit per element, in words of bit_word_size bits.
+ *
+ * Same interface as vector, plus flip() and the word at a time
+ * helpers count(), find_first() and find_next(). operator[] and the
+ * iterators give bit_reference proxies (a plain bool when const).
+ * Fills, copies, comparisons and counts go a word at a time; inserts
+ * and erases move the following bits a word at a time.
+ *
+ * The bits past size() are kept at 0, so whole words can be compared
+ * and counted.
+*/
+template <class Alloc> class vector<bool, Alloc>
+{
+public:
+
+    /*
+     * **************************************
+     * ********** Member Types **************
+     * **************************************
+    */
+
+    typedef bool        value_type;
+    typedef Alloc       allocator_type;
+
+    typedef bit_reference   reference;
+    typedef bool            const_reference;
+
+    typedef typename allocator_type::size_type       size_type;
+    typedef typename allocator_type::difference_type difference_type;
+
+    /*
+     * **************************************
+     * ********* Iterator Types *************
+     * **************************************
+    */
+
+    typedef bit_iterator<bit_word>          iterator;
+    typedef bit_iterator<const bit_word>    const_iterator;
+
+    typedef reverse_iterator<const_iterator>       const_reverse_iterator;
+    typedef reverse_iterator<iterator>             reverse_iterator;
+
+private:
+
+    typedef typename Alloc::template rebind<bit_word>::other  word_allocator_type;
+
+    /*
+     * **************************************
+     * ************ Variables ***************
+     * **************************************
+    */
+
+    // Allocator and capacity in words, an empty allocator takes no space
+    ft::compressed_pair<word_allocator_type, size_type>  _al_cp;
+    bit_word *      _ar;    // Underlying words
+    size_type       _sz;    // this.size(), in bits
+
+    /*
+     * **************************************
+     * ********* Private Functions **********
+     * **************************************
+    */
+
+    word_allocator_type&       _alloc()       { return _al_cp.first(); }
+    const word_allocator_type& _alloc() const { return _al_cp.first(); }
+    size_type&                 _cap()         { return _al_cp.second(); }
+    const size_type&           _cap()   const { return _al_cp.second(); }
+
+    // words holding n bits
+    static size_type _words(size_type n) { return (n + bit_word_size - 1) / bit_word_size; }
+
+    // mask of the bits under n in a word
+    static bit_word _low_mask(unsigned n) {
+        return n == bit_word_size ? ~bit_word(0) : (bit_word(1) << n) - 1;
+    }
+
+    // New array of words for the bits, zeroed past size()
+    void realloc_self(size_type new_cp) {
+        bit_word *old_ar = _ar;
+        size_type used = _words(_sz);
+
+        _ar = _alloc().allocate(new_cp);
+        if (used)
+            std::memcpy(_ar, old_ar, used * sizeof(bit_word));
+        std::memset(_ar + used, 0, (new_cp - used) * sizeof(bit_word));
+        if (_cap())
+            _alloc().deallocate(old_ar, _cap());
+        _cap() = new_cp;
+    }
+
+    // room for n bits, doubling the capacity
+    void _grow(size_type n) {
+        if (_words(n) > _cap())
+            realloc_self(std::max(_cap() * 2, _words(n)));
+    }
+
+    // n bits read from bit pos, n <= bit_word_size
+    bit_word _load(size_type pos, unsigned n) const {
+        const bit_word *w = _ar + pos / bit_word_size;
+        unsigned off = pos % bit_word_size;
+        bit_word bits = w[0] >> off;
+        if (off && off + n > bit_word_size)
+            bits |= w[1] << (bit_word_size - off);
+        return bits & _low_mask(n);
+    }
+
+    // the n low bits of bits written at bit pos
+    void _store(size_type pos, unsigned n, bit_word bits) {
+        bit_word *w = _ar + pos / bit_word_size;
+        unsigned off = pos % bit_word_size;
+        bit_word mask = _low_mask(n);
+        w[0] = (w[0] & ~(mask << off)) | (bits << off);
+        if (off && off + n > bit_word_size) {
+            unsigned done = bit_word_size - off;
+            w[1] = (w[1] & ~(mask >> done)) | (bits >> done);
+        }
+    }
+
+    // memmove of n bits, from bit src to bit dst
+    void _move_bits(size_type dst, size_type src, size_type n) {
+        if (dst < src)
+            for (size_type k = 0; k < n; k += bit_word_size) {
+                unsigned len = std::min<size_type>(bit_word_size, n - k);
+                _store(dst + k, len, _load(src + k, len));
+            }
+        else if (dst > src)
+            for (size_type k = n; k > 0; ) {
+                unsigned len = std::min<size_type>(bit_word_size, k);
+                k -= len;
+                _store(dst + k, len, _load(src + k, len));
+            }
+    }
+
+    // bits [first, last) set to x, whole words at once
+    void _fill(size_type first, size_type last, bool x) {
+        if (first >= last)
+            return;
+        size_type fw = first / bit_word_size;
+        size_type lw = (last - 1) / bit_word_size;
+        bit_word head = ~_low_mask(first % bit_word_size);
+        bit_word tail = _low_mask((last - 1) % bit_word_size + 1);
+
+        if (fw == lw)
+            head &= tail;
+        _ar[fw] = x ? _ar[fw] | head : _ar[fw] & ~head;
+        if (fw == lw)
+            return;
+        if (lw > fw + 1)
+            std::memset(_ar + fw + 1, x ? 0xff : 0, (lw - fw - 1) * sizeof(bit_word));
+        _ar[lw] = x ? _ar[lw] | tail : _ar[lw] & ~tail;
+    }
+
+    template <class Ite>
+    size_type _range(Ite first, Ite last){
+        size_type ret = 0;
+        while (first != last){
+            ++first;
+            ++ret;
+        }
+        return ret;
+    }
+
+public:
+
+    /*
+     * **************************************
+     * ********* Member Functions ***********
+     * **************************************
+    */
+
+    // ***** Constructors *****
+
+    explicit vector(const allocator_type& alloc = allocator_type()):
+        _al_cp(word_allocator_type(alloc), 0),
+        _ar(0), _sz(0){}
+
+    // Fill
+    explicit vector(size_type n,
+                    const value_type& val = value_type(),
+                    const allocator_type& alloc = allocator_type()):
+        _al_cp(word_allocator_type(alloc), 0),
+        _ar(0), _sz(0)
+    {
+        insert(end(), n, val);
+    }
+
+    // Range
+    template <class InputIt>
+    vector(typename ft::enable_if<!is_integral<InputIt>::value, InputIt>::type first, InputIt last,
+            const allocator_type& alloc = allocator_type()):
+        _al_cp(word_allocator_type(alloc), 0),
+        _ar(0), _sz(0)
+    {
+        insert(end(), first, last);
+    }
+
+    // Copy: the words are copied
+    vector (const vector& cpy):
+        _al_cp(cpy._alloc(), 0),
+        _ar(0), _sz(0)
+    {
+        *this = cpy;
+    }
+
+    // ***** Destructor *****
+    ~vector(){
+        if (_cap())
+            _alloc().deallocate(_ar, _cap());
+    }
+
+    // ***** Assignment operator *****
+    vector& operator=(const vector& cpy) {
+        if (&cpy == this)
+            return *this;
+        clear();
+        _grow(cpy._sz);
+        if (cpy._sz)
+            std::memcpy(_ar, cpy._ar, _words(cpy._sz) * sizeof(bit_word));
+        _sz = cpy._sz;
+        return *this;
+    }
+
+    /*
+     * **************************************
+     * ************ Iterators ***************
+     * **************************************
+    */
+
+    iterator begin() { return iterator(_ar, 0); }
+    const_iterator begin() const { return const_iterator(_ar, 0); }
+
+    reverse_iterator rbegin() { return reverse_iterator(end()); }
+    const_reverse_iterator rbegin() const { return const_reverse_iterator(end()); }
+
+    iterator end() { return begin() + _sz; }
+    const_iterator end() const { return begin() + _sz; }
+
+    reverse_iterator rend() { return reverse_iterator(begin()); }
+    const_reverse_iterator rend() const { return const_reverse_iterator(begin()); }
+
+    /*
+     * **************************************
+     * ************* Capacity ***************
+     * **************************************
+    */
+
+    size_type size() const { return _sz; }
+
+    size_type max_size() const { return std::numeric_limits<difference_type>::max(); }
+
+    size_type capacity() const { return _cap() * bit_word_size; }
+
+    bool empty() const { return !_sz; }
+
+    void resize (size_type n, value_type val = value_type()) {
+        if (n < _sz) {
+            _fill(n, _sz, false);
+            _sz = n;
+        }
+        else
+            insert(end(), n - _sz, val);
+    }
+
+    void reserve(size_type n){
+        if (n > max_size())
+            throw std::length_error("vector::reserve");
+        if (_words(n) > _cap())
+            realloc_self(_words(n));
+    }
+
+    // Reduces capacity to the words of size, releasing them all if empty
+    void shrink_to_fit() {
+        if (_words(_sz) == _cap())
+            return;
+        if (!_sz) {
+            _alloc().deallocate(_ar, _cap());
+            _ar = 0;
+            _cap() = 0;
+        }
+        else
+            realloc_self(_words(_sz));
+    }
+
+    /*
+     * **************************************
+     * ********** Element Access ************
+     * **************************************
+    */
+
+    allocator_type get_allocator() const { return allocator_type(_alloc()); }
+
+    reference       operator[](size_type pos)       { return begin()[pos]; }
+    const_reference operator[](size_type pos) const { return begin()[pos]; }
+
+private:
+    void _at_range_check(size_type n) const {
+        if ( n >= _sz)
+            throw (std::out_of_range(SSTR("vector<bool>::_M_range_check: __n (which is "
+                   << n << ") >= this->size() (which is " << _sz << ')')));
+    }
+public:
+    reference       at(size_type pos)       { _at_range_check(pos); return (*this)[pos]; }
+    const_reference at(size_type pos) const { _at_range_check(pos); return (*this)[pos]; }
+
+    reference       front()       { return *begin(); }
+    const_reference front() const { return *begin(); }
+
+    reference       back()       { return *(end() - 1); }
+    const_reference back() const { return *(end() - 1); }
+
+    /*
+     * **************************************
+     * *********** Bit helpers **************
+     * **************************************
+    */
+
+    // Number of true bits, a popcount per word
+    size_type count() const {
+        size_type ret = 0;
+        for (size_type i = 0; i < _words(_sz); ++i)
+            ret += __builtin_popcountl(_ar[i]);
+        return ret;
+    }
+
+    // Place of the first true bit, size() if none
+    size_type find_first() const { return _find_from(0); }
+
+    // Place of the first true bit after pos, size() if none
+    size_type find_next(size_type pos) const { return _find_from(pos + 1); }
+
+    // Every bit inverted
+    void flip() {
+        for (size_type i = 0; i < _words(_sz); ++i)
+            _ar[i] = ~_ar[i];
+        if (_sz % bit_word_size)
+            _ar[_sz / bit_word_size] &= _low_mask(_sz % bit_word_size);
+    }
+
+private:
+    size_type _find_from(size_type pos) const {
+        if (pos >= _sz)
+            return _sz;
+        size_type w = pos / bit_word_size;
+        bit_word bits = _ar[w] & ~_low_mask(pos % bit_word_size);
+        while (!bits) {
+            if (++w == _words(_sz))
+                return _sz;
+            bits = _ar[w];
+        }
+        return w * bit_word_size + __builtin_ctzl(bits);
+    }
+
+public:
+    /*
+     * **************************************
+     * ************ Modifiers ***************
+     * **************************************
+    */
+
+    void push_back (const value_type& val){
+        _grow(_sz + 1);
+        if (val)
+            _ar[_sz / bit_word_size] |= bit_word(1) << (_sz % bit_word_size);
+        ++_sz;
+    }
+
+    void pop_back() {
+        --_sz;
+        _ar[_sz / bit_word_size] &= ~(bit_word(1) << (_sz % bit_word_size));
+    }
+
+    // Inserts value before pos
+    iterator insert( iterator pos, const value_type& value ) {
+        size_type goal = pos - begin();
+        insert(pos, 1, value);
+        return begin() + goal;
+    }
+
+    // Inserts count copies of the value before pos
+    void insert( iterator pos, size_type count, const value_type& value ) {
+        size_type goal = pos - begin();
+
+        _grow(_sz + count);
+        _move_bits(goal + count, goal, _sz - goal);
+        _fill(goal, goal + count, value);
+        _sz += count;
+    }
+
+    template <class InputIt>
+    void insert(iterator pos,
+                typename ft::enable_if<!is_integral<InputIt>::value, InputIt>::type first,
+                InputIt last)
+    {
+        _insert_pv(pos, first, last,
+                  typename iterator_traits<InputIt>::iterator_category());
+    }
+
+private:
+    // Only an input_iterator: read in a vector first
+    template <class InputIt>
+    void _insert_pv(iterator pos, InputIt first, InputIt last, std::input_iterator_tag) {
+        vector tmp;
+        while (first != last)
+            tmp.push_back(*first++);
+        insert(pos, tmp.begin(), tmp.end());
+    }
+
+    // the room is made once, then the bits written
+    template <class InputIt>
+    void _insert_pv(iterator pos, InputIt first, InputIt last, std::forward_iterator_tag) {
+        size_type goal = pos - begin();
+        size_type range = _range(first, last);
+
+        insert(pos, range, false);
+        for (iterator it = begin() + goal; first != last; ++it, ++first)
+            if (*first)
+                *it = true;
+    }
+
+public:
+    void assign( size_type count, const value_type& value ) {
+        clear();
+        insert(end(), count, value);
+    }
+
+    template< class InputIt >
+    void assign( typename ft::enable_if<!is_integral<InputIt>::value, InputIt>::type first, InputIt last )
+    {
+        clear();
+        insert(end(), first, last);
+    }
+
+    iterator erase( iterator pos ) { return erase(pos, pos + 1); }
+
+    // the bits after last are moved down, a word at a time
+    iterator erase( iterator first, iterator last) {
+        size_type goal = first - begin();
+        size_type range = last - first;
+
+        _move_bits(goal, goal + range, _sz - goal - range);
+        _fill(_sz - range, _sz, false);
+        _sz -= range;
+        return begin() + goal;
+    }
+
+    void swap(vector &x) {
+        bit_word * tmp_ar = x._ar;
+        size_type  tmp_sz = x._sz;
+        size_type  tmp_cp = x._cap();
+
+        x._ar = _ar;
+        x._sz = _sz;
+        x._cap() = _cap();
+
+        _ar = tmp_ar;
+        _sz = tmp_sz;
+        _cap() = tmp_cp;
+    }
+
+    // Swaps two bits
+    static void swap(reference x, reference y) {
+        bool tmp = x;
+        x = y;
+        y = tmp;
+    }
+
+    void clear() {
+        if (_sz)
+            std::memset(_ar, 0, _words(_sz) * sizeof(bit_word));
+        _sz = 0;
+    }
+
+    /*
+     * **************************************
+     * ********** Word comparisons **********
+     * **************************************
+    */
+
+    template <class A>
+    friend bool operator==(const vector<bool, A>&, const vector<bool, A>&);
+    template <class A>
+    friend bool operator<(const vector<bool, A>&, const vector<bool, A>&);
+};
+
+// These are picked over the ones of vector<T>, the others use them
+
+// Same size, then a memcmp of the words
+template <class Alloc>
+bool operator==(const vector<bool, Alloc>& lhs,
+                const vector<bool, Alloc>& rhs) {
+    return lhs._sz == rhs._sz
+        && (!lhs._sz || !std::memcmp(lhs._ar, rhs._ar, lhs._words(lhs._sz) * sizeof(bit_word)));
+}
+
+// The first differing word, then its first differing bit
+template <class Alloc>
+bool operator<(const vector<bool, Alloc>& lhs,
+                const vector<bool, Alloc>& rhs) {
+    typedef typename vector<bool, Alloc>::size_type size_type;
+    size_type n = std::min(lhs._sz, rhs._sz);
+
+    for (size_type w = 0; w < lhs._words(n); ++w) {
+        bit_word diff = lhs._ar[w] ^ rhs._ar[w];
+        if (w == n / bit_word_size)
+            diff &= lhs._low_mask(n % bit_word_size);
+        if (diff)
+            return !(lhs._ar[w] >> __builtin_ctzl(diff) & 1);
+    }
+    return lhs._sz < rhs._sz;
+}
+
+}
+
+#endif
@@ -0,0 +1,165 @@
+#include "../tests.hpp"
+#include <list>
+
+template<class deq>
+void print_deq(deq &d)
+{
+    for (typename deq::iterator it = d.begin(); it != d.end() ; it++)
+        std::cout << *it << ':';
+    std::cout << " (" << d.size() << ')' << std::endl;
+}
+
+void tst_deq_push_pop()
+{
+    print_green("tst push/pop both ends", __LINE__);
+    ft::deque<int> deq;
+
+    for (int i = 0; i < 5000; ++i)
+        deq.push_back(i);
+    for (int i = 0; i < 5000; ++i)
+        deq.push_front(-i);
+    std::cout << deq.size() << ' ' << deq.front() << ' ' << deq.back() << std::endl;
+    std::cout << deq[0] << ' ' << deq[4999] << ' ' << deq[5000] << ' ' << deq[9999] << std::endl;
+
+    for (int i = 0; i < 4990; ++i)
+        deq.pop_front();
+    for (int i = 0; i < 4990; ++i)
+        deq.pop_back();
+    print_deq(deq);
+    while (!deq.empty())
+        deq.pop_back();
+    print_deq(deq);
+    deq.push_front(42);
+    print_deq(deq);
+}
+
+void tst_deq_ctr()
+{
+    print_green("tst constructors", __LINE__);
+    ft::deque<int> first;
+    ft::deque<int> second(4, 100);
+    ft::deque<int> third(second.begin(), second.end());
+    ft::deque<int> fourth(third);
+
+    int myints[] = {16, 2, 77, 29};
+    ft::deque<int> fifth(myints, myints + sizeof(myints) / sizeof(int));
+
+    print_deq(first);
+    print_deq(second);
+    print_deq(third);
+    print_deq(fourth);
+    print_deq(fifth);
+
+    first = fifth;
+    fifth = ft::deque<int>();
+    print_deq(first);
+    print_deq(fifth);
+}
+
+void tst_deq_insert_erase()
+{
+    print_green("tst insert/erase", __LINE__);
+    ft::deque<std::string> deq;
+    for (int i = 0; i < 10; ++i)
+        deq.push_back(std::string(i + 1, 'a' + i));
+
+    ft::deque<std::string>::iterator it = deq.insert(deq.begin() + 2, "front half");
+    std::cout << *it << std::endl;
+    it = deq.insert(deq.end() - 2, "back half");
+    std::cout << *it << std::endl;
+    deq.insert(deq.begin() + 1, 3, "x3");
+    deq.insert(deq.end() - 1, 2, "y2");
+    print_deq(deq);
+
+    std::list<std::string> lst(3, "lst");
+    deq.insert(deq.begin() + 4, lst.begin(), lst.end());
+    deq.insert(deq.begin() + deq.size() / 2, lst.begin(), lst.end());
+    print_deq(deq);
+
+    it = deq.erase(deq.begin() + 1);
+    std::cout << *it << std::endl;
+    it = deq.erase(deq.end() - 3);
+    std::cout << *it << std::endl;
+    it = deq.erase(deq.begin() + 2, deq.begin() + 6);
+    std::cout << *it << std::endl;
+    it = deq.erase(deq.begin() + deq.size() / 2, deq.end() - 1);
+    std::cout << *it << std::endl;
+    print_deq(deq);
+}
+
+void tst_deq_big_insert()
+{
+    print_green("tst insert across chunks", __LINE__);
+    ft::deque<int> deq(3000, 1);
+    deq.insert(deq.begin() + 1000, 5000, 2);
+    deq.insert(deq.end() - 10, 3000, 3);
+    std::cout << deq.size() << ' ' << deq[999] << ' ' << deq[1000] << ' '
+              << deq[5999] << ' ' << deq[6000] << ' ' << deq[deq.size() - 11]
+              << ' ' << deq[deq.size() - 10] << std::endl;
+    deq.erase(deq.begin() + 10, deq.begin() + 7000);
+    std::cout << deq.size() << ' ' << deq[9] << ' ' << deq[10] << std::endl;
+    long sum = 0;
+    for (ft::deque<int>::const_iterator cit = deq.begin(); cit != deq.end(); ++cit)
+        sum += *cit;
+    std::cout << "sum: " << sum << std::endl;
+}
+
+void tst_deq_iterators()
+{
+    print_green("tst iterators", __LINE__);
+    ft::deque<int> deq;
+    for (int i = 0; i < 3000; ++i)
+        deq.push_front(i);
+
+    ft::deque<int>::iterator it = deq.begin();
+    ft::deque<int>::const_iterator cit = deq.end();
+    std::cout << (cit - it) << ' ' << (it < cit) << ' ' << *(it + 1500) << std::endl;
+    it += 2500;
+    std::cout << *it << ' ' << it[-1000] << ' ' << *(it - 2000) << std::endl;
+
+    for (ft::deque<int>::reverse_iterator rit = deq.rbegin(); rit != deq.rbegin() + 5; ++rit)
+        std::cout << *rit << ' ';
+    std::cout << std::endl;
+}
+
+void tst_deq_access()
+{
+    print_green("tst access/capacity", __LINE__);
+    ft::deque<int> deq(3, 7);
+    try { deq.at(10); }
+    catch (std::out_of_range &e) { std::cout << "out_of_range" << std::endl; }
+    deq.at(1) = 8;
+    deq.resize(5, 9);
+    print_deq(deq);
+    deq.resize(2);
+    print_deq(deq);
+    deq.assign(4, 1);
+    print_deq(deq);
+    deq.clear();
+    print_deq(deq);
+    std::cout << deq.empty() << std::endl;
+}
+
+void tst_deq_compare()
+{
+    print_green("tst swap/comparisons", __LINE__);
+    ft::deque<int> a(3, 100);
+    ft::deque<int> b(2, 200);
+
+    a.swap(b);
+    print_deq(a);
+    print_deq(b);
+    std::cout << (a == b) << (a != b) << (a < b) << (a > b)
+              << (a <= b) << (a >= b) << std::endl;
+}
+
+void deque_all_tests() {
+    print_green(__FILE__);
+    tst_deq_ctr();
+    tst_deq_push_pop();
+    tst_deq_insert_erase();
+    tst_deq_big_insert();
+    tst_deq_iterators();
+    tst_deq_access();
+    tst_deq_compare();
+}
@@ -29,7 +29,11 @@ void print_green(const char *s, int line)
 
 int main() {
     vector_all_tests();
+    deque_all_tests();
     stack_all_tests();
+    queue_all_tests();
     map_all_tests();
+    persistent_map_all_tests();
     set_all_tests();
+    string_all_tests();
 }
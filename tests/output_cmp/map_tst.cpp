@@ -665,6 +665,444 @@ void tst_relationals(){
     if (foo>=bar) std::cout << "foo is greater than or equal to bar\n";
 }
 
+// c++98 std::map has no node handles: the std output is made
+// by copying the element and erasing it
+void tst_extract_merge(){
+    print_green("tst extract/insert node/merge", __LINE__);
+    typedef ft::map<int, std::string> mpis;
+    mpis a;
+    mpis b;
+
+    for (int i = 0; i < 10; ++i){
+        a[i * 2] = std::string(1, 'a' + i);
+        b[i * 3] = std::string(1, 'A' + i);
+    }
+#ifdef OG
+    std::string moved = a[4];
+    a.erase(4);
+    b.insert(ft::make_pair(41, moved + "!"));
+    std::cout << "inserted: " << true << ", empty: " << true << "\n";
+    std::cout << "inserted: " << false << ", empty: " << false << "\n";
+#else
+    mpis::node_handle_type nh = a.extract(4);
+    nh.key() = 41;
+    nh.mapped() += "!";
+    mpis::insert_return_type ret = b.insert(nh);
+    std::cout << "inserted: " << ret.inserted << ", empty: " << nh.empty() << "\n";
+    // 0 is already in b, the node comes back in ret
+    ret = b.insert(a.extract(a.find(0)));
+    std::cout << "inserted: " << ret.inserted << ", empty: " << ret.node.empty() << "\n";
+    a.insert(ret.node);
+#endif
+    print_map(a);
+    print_map(b);
+#ifdef OG
+    for (mpis::iterator it = b.begin(); it != b.end(); ){
+        if (!a.count(it->first)){
+            a.insert(*it);
+            b.erase(it++);
+        }
+        else
+            ++it;
+    }
+#else
+    a.merge(b);
+#endif
+    print_map(a);
+    print_map(b);
+    while (!a.empty()){
+#ifdef OG
+        b.insert(*a.begin());
+        a.erase(a.begin());
+#else
+        b.insert(a.extract(a.begin()));
+#endif
+    }
+    std::cout << a.size() << ' ' << b.size() << ' ' << (a.begin() == a.end()) << '\n';
+    a[7] = "again";
+    print_map(a);
+}
+
+#ifdef OG
+// std has algorithms on sorted ranges, inserting in a new map
+# define MAP_OP(name, a, b, out) \
+    std::name(a.begin(), a.end(), b.begin(), b.end(), \
+              std::inserter(out, out.end()), a.value_comp())
+#else
+# define MAP_OP(name, a, b, out) out = ft::name(a, b)
+#endif
+
+void tst_map_algebra(){
+    print_green("tst map union/intersection/difference", __LINE__);
+    typedef ft::map<int, std::string> mpis;
+    mpis a;
+    mpis b;
+    mpis u, in, d;
+
+    for (int i = 0; i < 25; ++i){
+        a[i * 2] = std::string(1, 'a' + i);
+        b[i * 5] = std::string(1, 'A' + i);
+    }
+    // values are taken from the left map when keys are in both
+    MAP_OP(set_union, a, b, u);
+    MAP_OP(set_intersection, b, a, in);
+    MAP_OP(set_difference, a, b, d);
+    print_map(u);
+    print_map(in);
+    print_map(d);
+}
+
+// values already in the map win over the ones joined or inserted
+void tst_map_split_join(){
+    print_green("tst map split/parallel_union/insert_batch", __LINE__);
+    typedef ft::map<int, std::string> mpis;
+    mpis a;
+    mpis right;
+
+    for (int i = 0; i < 20; ++i)
+        a[i * 3] = std::string(1, 'a' + i);
+#ifdef OG
+    right = mpis(a.lower_bound(30), a.end());
+    a.erase(a.lower_bound(30), a.end());
+#else
+    a.split(30, right);
+#endif
+    print_map(a);
+    print_map(right);
+    for (int i = 0; i < 10; ++i)
+        right[i * 4] = std::string(1, 'A' + i);
+    ft::pair<int, std::string> batch[] = {
+        ft::make_pair(1, std::string("one")),
+        ft::make_pair(3, std::string("three")),
+        ft::make_pair(1, std::string("uno")),
+        ft::make_pair(100, std::string("hundred"))
+    };
+#ifdef OG
+    a.insert(right.begin(), right.end());
+    right.clear();
+    a.insert(batch, batch + 4);
+#else
+    a.parallel_union(right, 2);
+    a.insert_batch(batch, batch + 4);
+#endif
+    print_map(a);
+    std::cout << right.size() << '\n';
+}
+
+void tst_map_find_batch(){
+    print_green("tst map find_batch", __LINE__);
+    typedef ft::map<std::string, int> mpsi;
+    mpsi m;
+    std::string keys[40];
+
+    for (int i = 0; i < 30; ++i)
+        m[std::string(i % 5 + 1, 'a' + i % 26)] = i;
+    for (int i = 0; i < 40; ++i)
+        keys[i] = std::string(i % 6 + 1, 'a' + i * 7 % 26);
+    mpsi::iterator found[40];
+#ifdef OG
+    for (int i = 0; i < 40; ++i)
+        found[i] = m.find(keys[i]);
+#else
+    m.find_batch(keys, keys + 40, found);
+#endif
+    for (int i = 0; i < 40; ++i){
+        if (found[i] == m.end())
+            std::cout << keys[i] << ":- ";
+        else {
+            found[i]->second += 100;
+            std::cout << found[i]->first << ':' << found[i]->second << ' ';
+        }
+    }
+    std::cout << '\n';
+}
+
+void tst_map_finger_search(){
+    print_green("tst map find_from/lower_bound_from", __LINE__);
+    ft::map<int, char> m;
+
+    for (int i = 0; i < 100; ++i)
+        m[i * i % 101] = 'a' + i % 26;
+    ft::map<int, char>::iterator it = m.begin();
+    for (int k = 0; k < 110; k += 3){
+#ifdef OG
+        it = m.lower_bound(k);
+        ft::map<int, char>::iterator found = m.find(k);
+#else
+        it = m.lower_bound_from(it, k);
+        ft::map<int, char>::iterator found = m.find_from(it, k);
+#endif
+        if (it != m.end())
+            std::cout << it->first << it->second;
+        std::cout << (found == m.end() ? '-' : found->second) << ' ';
+    }
+    std::cout << '\n';
+}
+
+// equal keys stay in insertion order, a new one goes after them
+void tst_multimap(){
+    print_green("tst multimap", __LINE__);
+    typedef ft::multimap<int, char> mmic;
+    mmic m;
+
+    for (int i = 0; i < 60; ++i)
+        m.insert(ft::make_pair(i * 7 % 13, static_cast<char>('a' + i % 26)));
+    print_map(m);
+    mmic::iterator it = m.insert(m.begin(), ft::make_pair(20, 'Z'));
+    std::cout << it->first << it->second << ' ' << m.size() << '\n';
+    for (int k = -1; k < 22; k += 3){
+        ft::pair<mmic::iterator, mmic::iterator> range = m.equal_range(k);
+        std::cout << k << ": " << m.count(k) << ' ';
+        for (; range.first != range.second; ++range.first)
+            std::cout << range.first->second;
+        mmic::iterator found = m.find(k);
+        std::cout << ' ' << (found == m.end() ? '-' : found->second) << '\n';
+    }
+    std::cout << "erased " << m.erase(3);
+    std::cout << ' ' << m.erase(3);
+    std::cout << ' ' << m.erase(20) << ' ' << m.size() << '\n';
+    m.erase(m.lower_bound(5), m.upper_bound(8));
+    print_map(m);
+
+    ft::map<int, char> uniq(m.begin(), m.end());
+    mmic copy(m);
+    copy.insert(uniq.begin(), uniq.end());
+    print_map(uniq);
+    print_map(copy);
+    std::cout << (copy == m) << (copy != m) << (m < copy) << (copy <= m) << '\n';
+    copy.swap(m);
+    std::cout << copy.size() << ' ' << m.size() << ' ' << m.count(0) << '\n';
+    m.clear();
+    std::cout << m.count(0) << (m.find(0) == m.end()) << (m.lower_bound(1) == m.end()) << '\n';
+}
+
+// the subtree sizes behind count() follow the nodes moved by extract
+// and merge, the std output copies and erases the elements instead
+void tst_multimap_count(){
+    print_green("tst multimap count", __LINE__);
+    typedef ft::multimap<int, int> mmii;
+    mmii a, b;
+
+    for (int i = 0; i < 200; ++i)
+        a.insert(ft::make_pair(i % 5, i));
+    for (int i = 0; i < 40; ++i){
+#ifdef OG
+        mmii::iterator it = a.find(i % 3);
+        b.insert(*it);
+        a.erase(it);
+#else
+        b.insert(a.extract(a.find(i % 3)));
+#endif
+    }
+    a.erase(a.find(4));
+    for (int k = -1; k < 6; ++k)
+        std::cout << a.count(k) << ' ' << b.count(k) << '\n';
+#ifdef OG
+    a.insert(b.begin(), b.end());
+    b.clear();
+#else
+    a.merge(b);
+#endif
+    a.erase(a.lower_bound(1), a.find(2));
+    for (int k = -1; k < 6; ++k)
+        std::cout << a.count(k) << ' ';
+    std::cout << a.size() << ' ' << b.count(0) << '\n';
+}
+
+// with equal keys, each result is the first of them, as find() gives
+void tst_multimap_find_batch(){
+    print_green("tst multimap find_batch", __LINE__);
+    typedef ft::multimap<int, int> mmii;
+    mmii m;
+    int keys[60];
+
+    for (int i = 0; i < 500; ++i)
+        m.insert(ft::make_pair(i * 7 % 41, i));
+    for (int i = 0; i < 60; ++i)
+        keys[i] = i * 5 % 47 - 2;
+    mmii::iterator found[60];
+#ifdef OG
+    for (int i = 0; i < 60; ++i)
+        found[i] = m.find(keys[i]);
+#else
+    m.find_batch(keys, keys + 60, found);
+#endif
+    for (int i = 0; i < 60; ++i){
+        if (found[i] == m.end())
+            std::cout << keys[i] << ":- ";
+        else
+            std::cout << found[i]->first << ':' << found[i]->second
+                << (found[i] == m.lower_bound(keys[i])) << ' ';
+    }
+    std::cout << '\n';
+}
+
+// std has no interval map, the reference scans a multimap of pairs
+#ifdef OG
+typedef ft::multimap<ft::pair<int, int>, char> imic;
+
+imic::iterator *scan_overlap(imic &m, int lo, int hi, bool closed, imic::iterator *out){
+    for (imic::iterator it = m.begin(); it != m.end(); ++it)
+        if ((closed ? it->first.first <= hi : it->first.first < hi) && lo < it->first.second)
+            *out++ = it;
+    return out;
+}
+#else
+typedef ft::interval_map<int, char> imic;
+#endif
+
+void print_intervals(imic::iterator *first, imic::iterator *last){
+    for (; first != last; ++first)
+        std::cout << '[' << (*first)->first.first << ',' << (*first)->first.second
+                  << ')' << (*first)->second << ' ';
+    std::cout << '\n';
+}
+
+void tst_interval_map(){
+    print_green("tst interval_map overlap/stab", __LINE__);
+    imic m;
+    imic::iterator found[80];
+
+    for (int i = 0; i < 60; ++i){
+        int lo = i * 37 % 101;
+        m.insert(ft::make_pair(ft::make_pair(lo, lo + i % 9 + (i % 4 ? 1 : 20)),
+                               static_cast<char>('a' + i % 26)));
+    }
+    m.insert(ft::make_pair(ft::make_pair(50, 52), 'Z'));
+    m.insert(ft::make_pair(ft::make_pair(50, 52), 'Y'));
+    for (int i = 0; i < 12; ++i)
+        m.erase(m.lower_bound(ft::make_pair(i * 23 % 101, 0)));
+    m.erase(ft::make_pair(3, 4));
+    std::cout << m.size() << '\n';
+    for (int lo = -5; lo < 110; lo += 17){
+        std::cout << lo << ',' << lo + 6 << ": ";
+#ifdef OG
+        print_intervals(found, scan_overlap(m, lo, lo + 6, false, found));
+#else
+        print_intervals(found, m.overlap(lo, lo + 6, found));
+#endif
+    }
+    for (int x = 0; x < 110; x += 13){
+        std::cout << x << ": ";
+#ifdef OG
+        print_intervals(found, scan_overlap(m, x, x, true, found));
+#else
+        print_intervals(found, m.stab(x, found));
+#endif
+    }
+    imic copy(m);
+    m.clear();
+    std::cout << "51: ";
+#ifdef OG
+    print_intervals(found, scan_overlap(copy, 51, 51, true, found));
+    print_intervals(found, scan_overlap(m, 0, 200, false, found));
+#else
+    print_intervals(found, copy.stab(51, found));
+    print_intervals(found, m.overlap(0, 200, found));
+#endif
+}
+
+// std has no other balancing, the reference is std::map for each
+#ifdef OG
+# define avl_map    map
+# define treap_map  map
+# define splay_map  map
+#endif
+
+template <class Map>
+void run_balanced_map(const char *name){
+    std::cout << name << '\n';
+    Map m;
+
+    for (int i = 0; i < 80; ++i)
+        m[40 + i * 29 % 83] = static_cast<char>('a' + i % 26);
+    m.insert(ft::make_pair(69, 'Z'));
+    m.insert(m.begin(), ft::make_pair(35, 'Y'));
+    print_map(m);
+    for (int k = 30; k < 130; k += 7){
+        typename Map::iterator found = m.find(k);
+        typename Map::iterator lower = m.lower_bound(k + 1);
+        std::cout << k << (found == m.end() ? '-' : found->second) << m.count(k)
+                  << (lower == m.end() ? '-' : lower->second) << ' ';
+    }
+    std::cout << '\n';
+    for (int k = 30; k < 130; k += 3)
+        std::cout << m.erase(k);
+    m.erase(m.begin());
+    m.erase(m.lower_bound(70), m.upper_bound(90));
+    std::cout << ' ' << m.size() << '\n';
+    for (typename Map::reverse_iterator it = m.rbegin(); it != m.rend(); ++it)
+        std::cout << it->first << it->second << ' ';
+    std::cout << '\n';
+
+    Map copy(m);
+    Map other(m.begin(), m.lower_bound(60));
+    copy[36] = '!';
+    std::cout << (copy == m) << (copy < m) << (m < copy) << (other <= m) << (other > m) << '\n';
+    other.swap(copy);
+    print_map(other);
+    print_map(copy);
+    copy = m;
+    m.clear();
+    std::cout << m.size() << copy.size() << (m.find(36) == m.end()) << '\n';
+    for (int i = 0; i < 2000; ++i)
+        m[i] = 'a' + i % 26;
+    for (int i = 0; i < 2000; i += 2)
+        m.erase(i);
+    std::cout << m.size() << ' ' << static_cast<int>(m.begin()->first) << ' '
+              << static_cast<int>((--m.end())->first) << '\n';
+}
+
+void tst_balanced_maps(){
+    print_green("tst avl_map, treap_map, splay_map", __LINE__);
+    run_balanced_map<ft::avl_map<int, char> >("avl");
+    run_balanced_map<ft::treap_map<int, char> >("treap");
+    run_balanced_map<ft::splay_map<int, char> >("splay");
+    run_balanced_map<ft::avl_map<char, char> >("avl, threaded");
+    run_balanced_map<ft::splay_map<char, char> >("splay, threaded");
+}
+
+#ifdef OG
+# undef avl_map
+# undef treap_map
+# undef splay_map
+#endif
+
+// std has no radix tree, the reference is std::map
+#ifdef OG
+# define int_map    map
+#endif
+
+void tst_int_map(){
+    print_green("tst int_map", __LINE__);
+    run_balanced_map<ft::int_map<int, char> >("int");
+    run_balanced_map<ft::int_map<char, char> >("char");
+
+    // negative and sparse keys, nodes of each size
+    ft::int_map<long, int> m;
+    for (int i = 0; i < 300; ++i){
+        m[i * 3 - 450] = i;
+        m[static_cast<long>(i % 7) << (i % 48)] = -i;
+    }
+    std::cout << m.size() << ' ' << m.begin()->first << ' ' << m.rbegin()->first << '\n';
+    for (long k = -460; k < 460; k += 37){
+        ft::int_map<long, int>::iterator lower = m.lower_bound(k);
+        ft::int_map<long, int>::const_iterator upper = m.upper_bound(k);
+        std::cout << lower->first << ':' << upper->first << ' ';
+    }
+    std::cout << '\n';
+    for (long k = -450; k < 450; k += 2)
+        m.erase(k);
+    long sum = 0;
+    for (ft::int_map<long, int>::const_iterator it = m.begin(); it != m.end(); ++it)
+        sum += it->first % 1000 + it->second;
+    std::cout << m.size() << ' ' << sum << ' ' << (m.lower_bound(1L << 50) == m.end()) << '\n';
+}
+
+#ifdef OG
+# undef int_map
+#endif
+
 void map_all_tests(){
     print_green(__FILE__);
 
@@ -694,6 +1132,17 @@ void map_all_tests(){
     tst_range_cpy();
     tst_fld_size();
     tst_relationals();
+    tst_extract_merge();
+    tst_map_algebra();
+    tst_map_split_join();
+    tst_map_find_batch();
+    tst_map_finger_search();
+    tst_multimap();
+    tst_multimap_count();
+    tst_multimap_find_batch();
+    tst_interval_map();
+    tst_balanced_maps();
+    tst_int_map();
 
     tst_failed_ones();
 }
@@ -0,0 +1,107 @@
+#include "../tests.hpp"
+
+// ft::persistent_map has the lookup interface of std::map,
+// a std::map copy gives the same results (just slower)
+#ifdef OG
+typedef std::map<int, std::string>  pmap;
+#else
+typedef ft::persistent_map<int, std::string>  pmap;
+#endif
+
+// std::map has no insert_or_assign in c++98
+static void assign(pmap &m, int k, const std::string &v){
+#ifdef OG
+    m[k] = v;
+#else
+    m.insert_or_assign(k, v);
+#endif
+}
+
+static void print_pmap(const pmap &m){
+    std::cout << "size: " << m.size() << " |";
+    for (pmap::const_iterator it = m.begin(); it != m.end(); ++it)
+        std::cout << ' ' << it->first << ':' << it->second;
+    std::cout << '\n';
+}
+
+void tst_pmap_modifiers(){
+    print_green("tst persistent_map insert/erase/find", __LINE__);
+    pmap m;
+
+    for (int i = 0; i < 20; ++i)
+        std::cout << m.insert(ft::make_pair(i * 7 % 20, std::string(i % 3 + 1, 'a' + i))).second;
+    std::cout << m.insert(ft::make_pair(3, std::string("dup"))).second << '\n';
+    print_pmap(m);
+    std::cout << m.erase(4) << m.erase(4) << m.erase(42) << '\n';
+    m.erase(m.find(0));
+    m.erase(m.find(19));
+    print_pmap(m);
+    std::cout << m.count(5) << m.count(4) << ' ' << m.find(11)->second << ' '
+              << (m.find(4) == m.end()) << '\n';
+    assign(m, 11, "eleven");
+    assign(m, 40, "forty");
+    print_pmap(m);
+    m.erase(m.lower_bound(6), m.upper_bound(12));
+    print_pmap(m);
+    m.erase(m.lower_bound(15), m.end());
+    print_pmap(m);
+    m.clear();
+    print_pmap(m);
+}
+
+void tst_pmap_iterators(){
+    print_green("tst persistent_map iterators/bounds", __LINE__);
+    pmap m;
+
+    for (int i = 0; i < 1000; ++i)
+        m.insert(ft::make_pair((i * 37) % 1000 * 2, std::string(1, 'a' + i % 26)));
+    long sum = 0;
+    for (pmap::const_reverse_iterator it = m.rbegin(); it != m.rend(); ++it)
+        sum = sum * 3 % 1000003 + it->first;
+    std::cout << sum << ' ' << m.begin()->first << ' ' << (--m.end())->first << '\n';
+    std::cout << m.lower_bound(51)->first << ' ' << m.lower_bound(52)->first << ' '
+              << m.upper_bound(52)->first << ' ' << (m.lower_bound(1999) == m.end())
+              << ' ' << (m.upper_bound(-1) == m.begin()) << '\n';
+    pmap::const_iterator it = m.find(500);
+    for (int i = 0; i < 5; ++i)
+        std::cout << (it++)->first << ' ';
+    for (int i = 0; i < 5; ++i)
+        std::cout << (--it)->first << ' ';
+    std::cout << '\n';
+}
+
+// Changes to a version never show in the others
+void tst_pmap_snapshots(){
+    print_green("tst persistent_map snapshots", __LINE__);
+    pmap m;
+
+    for (int i = 0; i < 10; ++i)
+        m.insert(ft::make_pair(i, std::string(1, 'a' + i)));
+    pmap snap(m);
+    pmap snap2;
+    snap2 = m;
+    for (int i = 0; i < 10; i += 2)
+        m.erase(i);
+    assign(m, 3, "changed");
+    m.insert(ft::make_pair(100, std::string("new")));
+    assign(snap2, 1, "other");
+    print_pmap(m);
+    print_pmap(snap);
+    print_pmap(snap2);
+    std::cout << (snap == m) << (snap != snap2) << (snap < snap2) << (m > snap)
+              << (snap <= snap) << (snap2 >= m) << '\n';
+    snap.swap(m);
+    print_pmap(m);
+    m = snap;
+    std::cout << (m == snap) << '\n';
+    snap.clear();
+    print_pmap(m);
+    print_pmap(snap);
+}
+
+void persistent_map_all_tests(){
+    print_green(__FILE__);
+    tst_pmap_modifiers();
+    tst_pmap_iterators();
+    tst_pmap_snapshots();
+}
@@ -0,0 +1,76 @@
+#include "../tests.hpp"
+
+// ft::ring_queue has the interface of std::queue
+#ifdef OG
+typedef std::queue<int>          queue_int;
+typedef std::queue<std::string>  queue_str;
+#else
+typedef ft::ring_queue<int>          queue_int;
+typedef ft::ring_queue<std::string>  queue_str;
+#endif
+
+void tst_queue_pushpop(){
+    print_green("tst queue push/pop", __LINE__);
+    queue_int q;
+
+    for (int i = 0; i < 5; ++i)
+        q.push(i);
+    std::cout << q.size() << ' ' << q.front() << ' ' << q.back() << '\n';
+
+    std::cout << "Popping out elements...";
+    while (!q.empty()) {
+        std::cout << ' ' << q.front();
+        q.pop();
+    }
+    std::cout << '\n';
+}
+
+void tst_queue_wrap(){
+    print_green("tst queue wrap around and growth", __LINE__);
+    queue_int q;
+    long      sum = 0;
+
+    // head keeps moving so the buffer wraps many times while growing
+    for (int i = 0; i < 10000; ++i){
+        q.push(i);
+        q.push(-i);
+        if (i % 3 == 0){
+            sum += q.front();
+            q.pop();
+        }
+    }
+    std::cout << q.size() << ' ' << q.front() << ' ' << q.back() << ' ' << sum << '\n';
+    while (q.size() > 3){
+        sum += q.front();
+        q.pop();
+    }
+    std::cout << q.size() << ' ' << q.front() << ' ' << q.back() << ' ' << sum << '\n';
+}
+
+void tst_queue_copy(){
+    print_green("tst queue copy/compare", __LINE__);
+    queue_str q;
+
+    for (int i = 0; i < 40; ++i){
+        q.push(std::string(i % 7 + 1, 'a' + i % 26));
+        if (i % 2)
+            q.pop();
+    }
+    queue_str cpy(q);
+    std::cout << (cpy == q) << (cpy != q) << '\n';
+    cpy.back() = "changed";
+    std::cout << (cpy == q) << (cpy != q) << '\n';
+    q = cpy;
+    while (!q.empty()){
+        std::cout << q.front() << ' ';
+        q.pop();
+    }
+    std::cout << '\n' << q.size() << ' ' << cpy.size() << '\n';
+}
+
+void queue_all_tests(){
+    print_green(__FILE__);
+    tst_queue_pushpop();
+    tst_queue_wrap();
+    tst_queue_copy();
+}
@@ -523,6 +523,399 @@ void tst_set_relationals(){
     if (foo>=bar) std::cout << "foo is greater than or equal to bar\n";
 }
 
+// c++98 std::set has no node handles: the std output is made
+// by copying the element and erasing it
+void tst_set_extract_merge(){
+    print_green("tst set extract/insert node/merge", __LINE__);
+    ft::set<int> a;
+    ft::set<int> b;
+
+    for (int i = 0; i < 30; ++i){
+        a.insert(i * 2);
+        b.insert(i * 3);
+    }
+#ifdef OG
+    a.erase(10);
+    b.insert(11);
+#else
+    ft::set<int>::node_handle_type nh = a.extract(10);
+    nh.value() = 11;
+    b.insert(b.begin(), nh);
+#endif
+#ifdef OG
+    for (ft::set<int>::iterator it = b.begin(); it != b.end(); ){
+        if (!a.count(*it)){
+            a.insert(*it);
+            b.erase(it++);
+        }
+        else
+            ++it;
+    }
+#else
+    a.merge(b);
+#endif
+    std::cout << a.size() << ' ' << b.size() << " |";
+    for (ft::set<int>::iterator it = a.begin(); it != a.end(); ++it)
+        std::cout << ' ' << *it;
+    std::cout << "\n" << b.size() << " |";
+    for (ft::set<int>::iterator it = b.begin(); it != b.end(); ++it)
+        std::cout << ' ' << *it;
+    std::cout << '\n';
+}
+
+#ifdef OG
+// std has algorithms on sorted ranges, inserting in a new set
+# define SET_OP(name, a, b, out) \
+    std::name(a.begin(), a.end(), b.begin(), b.end(), std::inserter(out, out.end()))
+# define INCLUDES(a, b) std::includes(a.begin(), a.end(), b.begin(), b.end())
+#else
+# define SET_OP(name, a, b, out) out = ft::name(a, b)
+# define INCLUDES(a, b) ft::includes(a, b)
+#endif
+
+template <class Set>
+void print_set(const char *name, const Set& s){
+    std::cout << name << " (" << s.size() << "):";
+    for (typename Set::const_iterator it = s.begin(); it != s.end(); ++it)
+        std::cout << ' ' << *it;
+    std::cout << '\n';
+}
+
+void tst_set_algebra(){
+    print_green("tst set union/intersection/difference/includes", __LINE__);
+    ft::set<int> a;
+    ft::set<int> b;
+    ft::set<int> small;
+    ft::set<int> empty;
+
+    for (int i = 0; i < 40; ++i){
+        a.insert(i * 2);
+        b.insert(i * 3);
+    }
+    small.insert(6);
+    small.insert(7);
+    for (int i = 0; i < 3; ++i){
+        ft::set<int> u, in, d, in_small, d_small, with_empty;
+        SET_OP(set_union, a, b, u);
+        SET_OP(set_intersection, a, b, in);
+        SET_OP(set_difference, a, b, d);
+        SET_OP(set_intersection, a, small, in_small);
+        SET_OP(set_difference, small, a, d_small);
+        SET_OP(set_union, empty, b, with_empty);
+        print_set("union", u);
+        print_set("intersection", in);
+        print_set("difference", d);
+        print_set("small intersection", in_small);
+        print_set("small difference", d_small);
+        print_set("union with empty", with_empty);
+        std::cout << INCLUDES(u, a) << INCLUDES(a, in) << INCLUDES(a, b)
+                  << INCLUDES(a, small) << INCLUDES(a, in_small) << INCLUDES(empty, a)
+                  << INCLUDES(a, empty) << '\n';
+        // the built trees must keep working
+        for (int j = 0; j < 100; j += 7){
+            u.erase(j);
+            u.insert(j + 1000);
+        }
+        print_set("union changed", u);
+        a.insert(i + 100);
+        b.erase(i * 3);
+    }
+}
+
+#ifdef OG
+// std has no split/join, the same results come from ranges
+template <class Set>
+void split(Set &s, const typename Set::key_type &k, Set &right){
+    right = Set(s.lower_bound(k), s.end());
+    s.erase(s.lower_bound(k), s.end());
+}
+
+template <class Set>
+void join(Set &s, Set &right){
+    s.insert(right.begin(), right.end());
+    right.clear();
+}
+
+template <class Set>
+void keep_found(Set &s, Set &other, bool found){
+    Set ret;
+    for (typename Set::iterator it = s.begin(); it != s.end(); ++it)
+        if ((other.find(*it) != other.end()) == found)
+            ret.insert(*it);
+    s.swap(ret);
+    other.clear();
+}
+# define SPLIT(s, k, right) split(s, k, right)
+# define JOIN(s, right) join(s, right)
+# define P_UNION(s, other) join(s, other)
+# define P_INTERSECTION(s, other) keep_found(s, other, true)
+# define P_DIFFERENCE(s, other) keep_found(s, other, false)
+# define INSERT_BATCH(s, first, last) s.insert(first, last)
+#else
+# define SPLIT(s, k, right) s.split(k, right)
+# define JOIN(s, right) s.join(right)
+# define P_UNION(s, other) s.parallel_union(other, 4)
+# define P_INTERSECTION(s, other) s.parallel_intersection(other, 2)
+# define P_DIFFERENCE(s, other) s.parallel_difference(other)
+# define INSERT_BATCH(s, first, last) s.insert_batch(first, last, 3)
+#endif
+
+void tst_set_split_join(){
+    print_green("tst set split/join/parallel operations/insert_batch", __LINE__);
+    ft::set<int> a;
+    ft::set<int> right;
+
+    for (int i = 0; i < 60; ++i)
+        a.insert(i * 7 % 60 * 2);
+    right.insert(-1);
+    SPLIT(a, 51, right);
+    print_set("split left", a);
+    print_set("split right", right);
+    SPLIT(right, 1000, a);
+    print_set("split all left", right);
+    print_set("split none", a);
+    JOIN(a, right);
+    print_set("joined", a);
+    print_set("joined right", right);
+    for (int i = 0; i < 10; ++i)
+        right.insert(i * 3 + 200);
+    JOIN(a, right);
+    right.insert(5);
+    right.insert(210);
+    right.insert(500);
+    JOIN(a, right);
+    print_set("joined again", a);
+
+    ft::set<int> b;
+    ft::set<int> c;
+    for (int i = 0; i < 50; ++i){
+        b.insert(i * 3);
+        c.insert(i * 5);
+    }
+    ft::set<int> b2(b), c2(c), b3(b), c3(c);
+    P_UNION(b, c);
+    P_INTERSECTION(b2, c2);
+    P_DIFFERENCE(b3, c3);
+    print_set("parallel union", b);
+    print_set("parallel intersection", b2);
+    print_set("parallel difference", b3);
+    std::cout << c.size() << c2.size() << c3.size() << '\n';
+
+    int vals[] = { 42, 7, 300, 7, -3, 42, 12, 301, 0, 5, 5 };
+    INSERT_BATCH(b2, vals, vals + 11);
+    print_set("insert_batch", b2);
+    // the trees must keep working
+    for (int i = 0; i < 50; i += 3){
+        b2.erase(i);
+        b2.insert(i + 1);
+    }
+    print_set("insert_batch changed", b2);
+}
+
+void tst_set_find_batch(){
+    print_green("tst set find_batch", __LINE__);
+    ft::set<int> s;
+    int keys[100];
+
+    for (int i = 0; i < 500; ++i)
+        s.insert(i * 37 % 1000);
+    for (int i = 0; i < 100; ++i)
+        keys[i] = (i * 53) % 1100 - 50;
+    ft::set<int>::const_iterator found[100];
+#ifdef OG
+    for (int i = 0; i < 100; ++i)
+        found[i] = s.find(keys[i]);
+#else
+    s.find_batch(keys, keys + 100, found);
+#endif
+    for (int i = 0; i < 100; ++i){
+        if (found[i] == s.end())
+            std::cout << '-';
+        else
+            std::cout << ' ' << *found[i];
+    }
+    std::cout << '\n';
+    ft::set<int> empty;
+#ifdef OG
+    found[0] = empty.find(keys[0]);
+#else
+    empty.find_batch(keys, keys + 1, found);
+#endif
+    std::cout << (found[0] == empty.end()) << '\n';
+}
+
+#ifdef OG
+// std has no finger search, the same results come from the root
+# define LOWER_BOUND_FROM(s, hint, k) s.lower_bound(k)
+# define FIND_FROM(s, hint, k) s.find(k)
+#else
+# define LOWER_BOUND_FROM(s, hint, k) s.lower_bound_from(hint, k)
+# define FIND_FROM(s, hint, k) s.find_from(hint, k)
+#endif
+
+void tst_set_finger_search(){
+    print_green("tst set find_from/lower_bound_from", __LINE__);
+    ft::set<int> s;
+
+    for (int i = 0; i < 300; ++i)
+        s.insert(i * 3);
+    ft::set<int>::iterator hint = s.begin();
+    int k = 0;
+    for (int i = 0; i < 60; ++i){
+        k += i % 7 - 2;
+        hint = LOWER_BOUND_FROM(s, hint, k);
+        std::cout << *hint << (FIND_FROM(s, hint, k + 1) == s.end()) << ' ';
+    }
+    std::cout << '\n';
+    std::cout << *LOWER_BOUND_FROM(s, s.end(), 50) << ' '
+              << (LOWER_BOUND_FROM(s, hint, 2000) == s.end()) << ' '
+              << *LOWER_BOUND_FROM(s, --s.end(), -20) << ' '
+              << *FIND_FROM(s, s.begin(), 897) << '\n';
+}
+
+// the end() nodes stay in their container when swapping
+void tst_set_swap_ends(){
+    print_green("tst set swap/clear with empty sets", __LINE__);
+    ft::set<int> a;
+    ft::set<int> b;
+    ft::set<int> empty;
+
+    for (int i = 0; i < 10; ++i)
+        a.insert(i * 2);
+    ft::set<int>::iterator it = a.find(8);
+    a.swap(b);
+    print_set("a", a);
+    print_set("b", b);
+    std::cout << *it << ' ';
+    std::cout << *++it << ' ';
+    std::cout << *----it << '\n';
+    b.swap(empty);
+    empty.swap(empty);
+    print_set("b", b);
+    print_set("empty", empty);
+    empty.clear();
+    empty.swap(b);
+    empty.insert(5);
+    b.insert(3);
+    print_set("empty", empty);
+    print_set("b", b);
+    std::cout << (a.begin() == a.end()) << (--b.end() == b.begin()) << '\n';
+}
+
+void tst_multiset(){
+    print_green("tst multiset", __LINE__);
+    typedef ft::multiset<std::string> mss;
+    mss s;
+    const char *words[] = { "to", "be", "or", "not", "to", "be", "that", "is",
+                            "the", "question", "to", "be" };
+
+    for (int i = 0; i < 12; ++i)
+        s.insert(words[i]);
+    print_set("s", s);
+    std::cout << s.count("to") << s.count("be") << s.count("is") << s.count("no") << '\n';
+    std::cout << *s.insert(s.end(), "be") << ' ' << s.count("be") << '\n';
+    ft::pair<mss::iterator, mss::iterator> range = s.equal_range("be");
+    std::cout << *range.first << ' ' << (range.second == s.end() ? "end" : *range.second) << '\n';
+    std::cout << s.erase("be") << ' ' << s.size() << '\n';
+    print_set("s", s);
+
+    ft::multiset<int> a;
+    for (int i = 0; i < 300; ++i)
+        a.insert(i * i % 17);
+    ft::multiset<int> b(a);
+    std::cout << a.size() << ' ' << a.count(0) << ' ' << a.count(4) << ' ' << a.count(5) << '\n';
+    b.erase(b.find(4));
+    b.erase(b.lower_bound(8), b.upper_bound(13));
+    print_set("b", b);
+    std::cout << (a == b) << (a < b) << (b < a) << (a >= b) << '\n';
+    a = b;
+    std::cout << (a == b) << ' ' << a.size() << '\n';
+}
+
+// std has no compressed set, the reference is std::set
+#ifdef OG
+# define int_set    set
+#endif
+
+template <class Set>
+void print_int_set(const char *name, const Set& s){
+    long sum = 0;
+    for (typename Set::const_iterator it = s.begin(); it != s.end(); ++it)
+        sum += *it;
+    std::cout << name << " (" << s.size() << "): sum " << sum;
+    if (!s.empty())
+        std::cout << ", " << *s.begin() << " to " << *s.rbegin();
+    std::cout << '\n';
+}
+
+void tst_int_set(){
+    print_green("tst int_set", __LINE__);
+    ft::int_set<int> small;
+    ft::int_set<int> runs;
+    ft::int_set<int> dense;
+
+    // a few keys per chunk, runs of keys, chunks of more than 4096 keys
+    for (int i = 0; i < 200; ++i)
+        small.insert(i * 997 - 50000);
+    for (int i = -30000; i < 90000; ++i)
+        if (i % 1000 < 700)
+            runs.insert(i);
+    for (int i = 0; i < 40000; ++i)
+        dense.insert(i * 7 % 120000);
+#ifndef OG
+    runs.shrink_to_fit();
+#endif
+    print_int_set("small", small);
+    print_int_set("runs", runs);
+    print_int_set("dense", dense);
+    print_set("small head", ft::int_set<int>(small.begin(), small.lower_bound(-40000)));
+
+    for (int k = -50000; k < 100000; k += 12345){
+        ft::int_set<int>::const_iterator lower = runs.lower_bound(k);
+        std::cout << k << ':' << runs.count(k) << dense.count(k)
+                  << (lower == runs.end() ? 0 : *lower) << ' ';
+    }
+    std::cout << '\n';
+    std::cout << runs.erase(10) << runs.erase(10) << runs.erase(800) << ' ';
+    for (int k = -30000; k < 90000; k += 3)
+        runs.erase(k);
+    runs.erase(runs.lower_bound(50000), runs.upper_bound(60000));
+    dense.erase(dense.begin());
+    print_int_set("runs erased", runs);
+
+    ft::int_set<int> u, in, d, in_small, d_small;
+    SET_OP(set_union, runs, dense, u);
+    SET_OP(set_intersection, runs, dense, in);
+    SET_OP(set_difference, dense, runs, d);
+    SET_OP(set_intersection, small, dense, in_small);
+    SET_OP(set_difference, small, runs, d_small);
+    print_int_set("union", u);
+    print_int_set("intersection", in);
+    print_int_set("difference", d);
+    print_set("small intersection", in_small);
+    print_int_set("small difference", d_small);
+    std::cout << INCLUDES(u, runs) << INCLUDES(dense, in) << INCLUDES(runs, dense)
+              << INCLUDES(small, in_small) << INCLUDES(d, d_small) << '\n';
+
+    ft::int_set<int> copy(u);
+    copy.insert(-1000000);
+    std::cout << (copy == u) << (copy < u) << (u < copy) << (in <= u) << '\n';
+    copy.swap(in);
+    print_int_set("swapped", copy);
+    u.clear();
+    std::cout << u.size() << (u.find(3) == u.end()) << '\n';
+
+    ft::int_set<char> chars;
+    for (int i = 0; i < 300; ++i)
+        chars.insert(static_cast<char>(i * 37));
+    std::cout << chars.size() << ' ' << static_cast<int>(*chars.begin()) << ' '
+              << static_cast<int>(*chars.rbegin()) << '\n';
+}
+
+#ifdef OG
+# undef int_set
+#endif
+
 void set_all_tests(){
     print_green(__FILE__);
 
@@ -549,6 +942,14 @@ void set_all_tests(){
     tst_set_range_cpy();
     tst_set_fld_size();
     tst_set_relationals();
+    tst_set_extract_merge();
+    tst_set_algebra();
+    tst_set_split_join();
+    tst_set_find_batch();
+    tst_set_finger_search();
+    tst_set_swap_ends();
+    tst_multiset();
+    tst_int_set();
 
     tst_set_failed_ones();
 }
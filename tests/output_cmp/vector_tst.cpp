@@ -1,6 +1,7 @@
 #include "../tests.hpp"
 #include <list>
 #include <cstddef>
+#include <stdexcept>
 
 class verbose
 {
@@ -662,6 +663,96 @@ void tst_vec_capacity()
 
 }
 
+void tst_vec_shrink_to_fit()
+{
+    typedef ft::vector<int> vec;
+
+    vec tst;
+    print_green("tst shrink_to_fit()", __LINE__);
+    for (int i = 0; i < 1000; ++i)
+        tst.push_back(i);
+    tst.erase(tst.begin() + 10, tst.end());
+    tst.clear();
+    tst.push_back(3);
+    tst.push_back(4);
+#ifndef OG
+    tst.shrink_to_fit();
+#else
+    vec(tst).swap(tst);     // no shrink_to_fit in c++98 std::vector
+#endif
+    std::cout << tst.capacity()  << '|' << tst.size() << std::endl;
+    print_vec(tst);
+    tst.push_back(5);
+    print_vec(tst);
+}
+
+// A type that opts in to vector_shrink_policy
+struct shrinky {
+    int v;
+    shrinky(int x = 0): v(x) {}
+};
+
+#ifdef OG
+// std::vector never shrinks: the capacity the policy gives is printed
+# define SHRINK_CP(vec, cp) (cp)
+#else
+namespace ft {
+template <> struct vector_shrink_policy<shrinky> {
+    static const bool           enabled = true;
+    static const std::size_t    min_capacity = 8;
+};
+}
+# define SHRINK_CP(vec, cp) ((void)(cp), (vec).capacity())
+#endif
+
+void print_shrinky(const ft::vector<shrinky> &vec, std::size_t cp)
+{
+    long sum = 0;
+    for (std::size_t i = 0; i < vec.size(); ++i)
+        sum += vec[i].v;
+    std::cout << SHRINK_CP(vec, cp) << '|' << vec.size() << " sum: " << sum << std::endl;
+}
+
+void tst_vec_shrink_policy()
+{
+    ft::vector<shrinky> tst;
+
+    print_green("tst vector_shrink_policy burst and drain", __LINE__);
+    for (int i = 0; i < 1000; ++i)
+        tst.push_back(i);
+    print_shrinky(tst, 1024);
+    while (tst.size() > 256)
+        tst.pop_back();
+    print_shrinky(tst, 1024);
+    tst.pop_back();
+    print_shrinky(tst, 512);
+
+    print_green("tst vector_shrink_policy hysteresis", __LINE__);
+    // back over a quarter: no growth, under it again: no shrink yet
+    tst.push_back(1);
+    tst.push_back(2);
+    print_shrinky(tst, 512);
+    tst.erase(tst.begin() + 128, tst.end());
+    print_shrinky(tst, 512);
+    tst.resize(127);
+    print_shrinky(tst, 256);
+    tst.erase(tst.begin() + 70);
+    tst.resize(100);
+    print_shrinky(tst, 256);
+
+    print_green("tst vector_shrink_policy min_capacity", __LINE__);
+    tst.erase(tst.begin() + 5, tst.end());
+    print_shrinky(tst, 16);
+    tst.clear();
+    print_shrinky(tst, 8);
+    for (int i = 0; i < 100; ++i)
+        tst.push_back(i);
+    tst.clear();
+    print_shrinky(tst, 8);
+    tst.push_back(7);
+    print_shrinky(tst, 8);
+}
+
 void failed_testers(){
     print_green("tst assign/insert with bidirectionnal its", __LINE__);
 	std::list<int> lst;
@@ -804,6 +895,45 @@ void    vectorTest_InsertNElem(T& cont)
     delete x;
 }
 
+// inserts that don't reallocate, around the edges of the elements
+void tst_vec_insert_in_capacity(){
+    std::string tab[] = {"1", "2", "3", "4"};
+    std::list<std::string> lst(tab, tab + 4);
+
+    print_green("tst insert more elements than follow pos", __LINE__);
+    ft::vector<std::string> v;
+    v.reserve(30);
+    v.push_back("a");
+    v.push_back("b");
+    v.push_back("c");
+    v.insert(v.begin() + 2, 5, "x");
+    print_vec(v);
+    v.insert(v.end() - 1, tab, tab + 4);
+    print_vec(v);
+    v.insert(v.end() - 2, lst.begin(), lst.end());
+    print_vec(v);
+
+    print_green("tst insert into an empty vector after reserve", __LINE__);
+    ft::vector<std::string> e;
+    e.reserve(10);
+    e.insert(e.begin(), tab, tab + 4);
+    print_vec(e);
+    ft::vector<std::string> e2;
+    e2.reserve(10);
+    e2.insert(e2.begin(), 3, "y");
+    print_vec(e2);
+
+    print_green("tst count insert on an empty vector with less capacity", __LINE__);
+    ft::vector<std::string> s;
+    s.reserve(2);
+    s.insert(s.begin(), 6, "z");
+    print_vec(s);
+    ft::vector<int> c(3, 1);
+    c.clear();
+    c.insert(c.begin(), 10, 4);
+    print_vec(c);
+}
+
 void vector_insert_tests_maker(){
     int tabi[] = {58966, 2147483647, 256, -214748, 3648, 0, -1, 2, 3, 4, 5};
     ft::vector<int> tstint(tabi, tabi + 10);
@@ -915,6 +1045,260 @@ void tst_derniereminute(){
     print_vec(vs);
 }
 
+#ifdef OG
+// count and find_first/find_next aren't in std::vector<bool>
+template <class vec> size_t vb_count(const vec &v) { return std::count(v.begin(), v.end(), true); }
+template <class vec> size_t vb_find_next(const vec &v, size_t pos) {
+    return std::find(v.begin() + pos, v.end(), true) - v.begin();
+}
+#else
+template <class vec> size_t vb_count(const vec &v) { return v.count(); }
+template <class vec> size_t vb_find_next(const vec &v, size_t pos) {
+    return pos ? v.find_next(pos - 1) : v.find_first();
+}
+#endif
+
+template <class vec>
+void print_vec_bool(const vec &v)
+{
+    std::cout << v.size() << " bits, " << vb_count(v) << " set:";
+    for (size_t i = vb_find_next(v, 0); i < v.size(); i = vb_find_next(v, i + 1))
+        std::cout << ' ' << i;
+    std::cout << std::endl;
+}
+
+void tst_vec_bool()
+{
+    typedef ft::vector<bool> vec;
+
+    print_green("tst vector<bool>", __LINE__);
+    vec v(70, false);
+    v[0] = true;
+    v[63] = v[0];
+    v.at(64).flip();
+    v.push_back(true);
+    print_vec_bool(v);
+    print_vec(v);
+
+    v.insert(v.begin() + 1, 130, true);
+    v.erase(v.begin() + 60, v.begin() + 125);
+    print_vec_bool(v);
+    v.flip();
+    print_vec_bool(v);
+    vec::swap(v.front(), v.back());
+    std::cout << v.front() << v.back() << v[1] << std::endl;
+
+    print_green("tst vector<bool> iterators and range insert", __LINE__);
+    std::list<bool> lst;
+    for (int i = 0; i < 100; ++i)
+        lst.push_back(i % 3 == 0);
+    vec w(lst.begin(), lst.end());
+    w.insert(w.begin() + 5, v.begin(), v.begin() + 20);
+    w.insert(w.end() - 3, lst.begin(), lst.end());
+    print_vec_bool(w);
+    vec::reverse_iterator rit = w.rbegin();
+    for (size_t i = 0; i < w.size(); i += 7)
+        rit[i] = !rit[i];
+    print_vec_bool(w);
+    vec::const_iterator cit = w.begin() + 40;
+    std::cout << (cit - w.begin()) << ' ' << (w.end() - cit) << ' ' << cit[1] << std::endl;
+
+    print_green("tst vector<bool> resize and comparisons", __LINE__);
+    vec x(w);
+    std::cout << (x == w) << (x < w) << (x != w) << std::endl;
+    x[150].flip();
+    std::cout << (x == w) << (x < w) << (w < x) << std::endl;
+    x.resize(100);
+    std::cout << (x < w) << (x >= w) << std::endl;
+    x.resize(300, true);
+    print_vec_bool(x);
+    x.assign(10, true);
+    x.pop_back();
+    print_vec_bool(x);
+    try { x.at(9); }
+    catch (std::out_of_range &e) { std::cout << e.what() << std::endl; }
+    x.clear();
+    std::cout << x.empty() << std::endl;
+}
+
+// std has no soa_vector, its results are those of a vector of pairs
+#ifdef OG
+typedef std::vector<std::pair<int, std::string> >   soa_type;
+#else
+typedef ft::soa_vector<int, std::string>            soa_type;
+#endif
+
+void print_soa(const soa_type &v)
+{
+    long sum = 0;
+    for (soa_type::const_iterator it = v.begin(); it != v.end(); ++it) {
+        std::cout << it->first << '=' << (*it).second << ':';
+        sum += it->first;
+    }
+    std::cout << " size " << v.size() << ", sum " << sum << std::endl;
+}
+
+void tst_soa_vector()
+{
+    print_green("tst soa_vector", __LINE__);
+    soa_type v;
+    for (int i = 0; i < 10; ++i)
+        v.push_back(ft::make_pair((i * 7) % 10, std::string(i % 3 + 1, 'a' + i)));
+    print_soa(v);
+
+    v.insert(v.begin() + 3, 2, ft::make_pair(42, std::string("x")));
+    v.erase(v.begin() + 6, v.begin() + 8);
+    v[0].first = -1;
+    v.at(1).second += "!";
+    v.back() = ft::make_pair(7, std::string("back"));
+    print_soa(v);
+
+    print_green("tst soa_vector sort and reverse iterators", __LINE__);
+    std::sort(v.begin(), v.end());
+    print_soa(v);
+    for (soa_type::reverse_iterator it = v.rbegin(); it != v.rend(); ++it)
+        std::cout << it->first << ' ';
+    std::cout << std::endl;
+    ft::pair<int, std::string> p = v[2];
+    std::cout << p.first << p.second << std::endl;
+
+    print_green("tst soa_vector range insert, resize and comparisons", __LINE__);
+    std::list<ft::pair<int, std::string> > lst;
+    lst.push_back(ft::make_pair(1, std::string("l1")));
+    lst.push_back(ft::make_pair(2, std::string("l2")));
+    soa_type w(lst.begin(), lst.end());
+    w.insert(w.begin() + 1, v.begin(), v.begin() + 4);
+    print_soa(w);
+    soa_type x(w);
+    std::cout << (x == w) << (x < w) << (x != w) << std::endl;
+    x[3].second = "zz";
+    std::cout << (x == w) << (x < w) << (w < x) << (x >= w) << std::endl;
+    x.resize(2);
+    x.resize(4, ft::make_pair(9, std::string("r")));
+    print_soa(x);
+    x.swap(w);
+    print_soa(x);
+    try { w.at(4); }
+    catch (std::out_of_range &e) { std::cout << "out_of_range" << std::endl; }
+    w.clear();
+    std::cout << w.empty() << std::endl;
+}
+
+// Its assignment throws once left gets to 0, never while it's negative
+struct throwing_assign {
+    int         v;
+    static int  left;
+
+    throwing_assign(int x = 0): v(x) {}
+    throwing_assign& operator=(const throwing_assign& x) {
+        if (left >= 0 && !left--)
+            throw std::runtime_error("throwing_assign");
+        v = x.v;
+        return *this;
+    }
+};
+int throwing_assign::left = -1;
+
+#ifdef OG
+typedef std::vector<std::pair<int, throwing_assign> >   soa_throw_type;
+#else
+typedef ft::soa_vector<int, throwing_assign>            soa_throw_type;
+#endif
+
+// both columns keep the same size when a second throws in erase
+void tst_soa_vector_erase_throw()
+{
+    print_green("tst soa_vector erase with a throwing second", __LINE__);
+    soa_throw_type v;
+    for (int i = 0; i < 8; ++i)
+        v.push_back(ft::make_pair(i, throwing_assign(i * 10)));
+    throwing_assign::left = 2;
+    try { v.erase(v.begin() + 1, v.begin() + 3); }
+    catch (std::runtime_error &e) { std::cout << e.what() << std::endl; }
+    throwing_assign::left = -1;
+    std::cout << v.size() << std::endl;
+    v.push_back(ft::make_pair(100, throwing_assign(1000)));
+    std::cout << v.size() << ' ' << v.back().first << ' ' << v.back().second.v << std::endl;
+    v.erase(v.begin(), v.begin() + 3);
+    v.resize(3);
+    std::cout << v.size() << ' ' << v.back().first << std::endl;
+}
+
+// std has no static_vector, its results are those of a vector
+#ifdef OG
+typedef std::vector<std::string>                static_type;
+#else
+typedef ft::static_vector<std::string, 32>      static_type;
+#endif
+
+void tst_static_vector()
+{
+    print_green("tst static_vector", __LINE__);
+    static_type v(3, "ab");
+    v.push_back("c");
+    v.insert(v.begin() + 1, 2, "mid");
+    v.insert(v.begin(), v.back());
+    std::string tab[] = {"1", "2", "3", "4", "5", };
+    v.insert(v.end() - 2, tab, tab + 5);
+    print_vec(v);
+    v.erase(v.begin() + 2);
+    v.erase(v.begin() + 4, v.begin() + 7);
+    print_vec(v);
+    std::cout << v.size() << ' ' << v.front() << ' ' << v.back() << ' ' << v.at(2) << std::endl;
+
+    print_green("tst static_vector assign, resize and comparisons", __LINE__);
+    std::list<std::string> lst(tab, tab + 3);
+    static_type w(lst.begin(), lst.end());
+    static_type x(w);
+    std::cout << (x == w) << (x < w) << (x != w) << std::endl;
+    x.push_back("0");
+    std::cout << (x == w) << (x < w) << (w < x) << (x >= w) << std::endl;
+    x.resize(6, "r");
+    print_vec(x);
+    x.resize(2);
+    x.swap(v);
+    print_vec(x);
+    print_vec(v);
+    v.assign(4, "a");
+    x = v;
+    v.assign(tab + 1, tab + 3);
+    print_vec(x);
+    print_vec(v);
+    for (static_type::reverse_iterator it = x.rbegin(); it != x.rend(); ++it)
+        *it += "!";
+    print_vec(x);
+    try { v.at(2); }
+    catch (std::out_of_range &e) { std::cout << "out_of_range" << std::endl; }
+    x.clear();
+    std::cout << x.empty() << std::endl;
+}
+
+#ifdef OG
+typedef std::vector<std::string>                small_static_type;
+#else
+typedef ft::static_vector<std::string, 4>       small_static_type;
+#endif
+
+// a range too long for the static_vector leaves it as it was
+void tst_static_vector_overflow()
+{
+    print_green("tst static_vector assign overflow", __LINE__);
+    std::string tab[] = {"1", "2", "3", "4", "5", "6", };
+    std::list<std::string> lst(tab, tab + 6);
+    small_static_type v(3, "keep");
+#ifdef OG
+    std::cout << "length_error" << std::endl << "length_error" << std::endl;
+#else
+    try { v.assign(tab, tab + 6); }
+    catch (std::length_error &e) { std::cout << "length_error" << std::endl; }
+    try { v.assign(lst.begin(), lst.end()); }
+    catch (std::length_error &e) { std::cout << "length_error" << std::endl; }
+#endif
+    print_vec(v);
+    v.assign(tab + 2, tab + 6);
+    print_vec(v);
+}
+
 void vector_all_tests() {
     vec_alloc_1by1(1);
     print_green("");
@@ -927,9 +1311,17 @@ void vector_all_tests() {
     tst_vec_arrow_operator();
     tst_vec_reverse_it();
     tst_vec_capacity();
+    tst_vec_shrink_to_fit();
+    tst_vec_shrink_policy();
     tst_vec_comparison();
     tst_capacity_assign();
+    tst_vec_bool();
+    tst_soa_vector();
+    tst_soa_vector_erase_throw();
+    tst_static_vector();
+    tst_static_vector_overflow();
 
+    tst_vec_insert_in_capacity();
     vector_insert_tests_maker();
     vector_delete_tests();
 
@@ -53,14 +53,14 @@ public:
 
     }
     void black_depth(typename map::node_type * n, int d) {
-        if (n->val &&  n->color == BLACK)
+        if (n->val &&  n->color() == BLACK)
             ++d;
         if ((!n->r && !n->l) || !n->val) {
             /*
             if (n->val)
                 std::cout << n->val->first << '/';
             else
-                std::cout << n->parent->val->first << '/';
+                std::cout << n->parent()->val->first << '/';
                 */
             std::cout << d << ' ';
             return;
@@ -79,7 +79,7 @@ public:
             for (i = 0; i < current_level; i++) {
                 std::cout << "    ";
             }
-            if (n->color == BLACK)
+            if (n->color() == BLACK)
                 std::cout << "\033[1;30;47m";
             else
                 std::cout << "\033[1;31m";
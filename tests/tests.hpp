@@ -9,14 +9,37 @@
 // "clang++ -DOG" to compile with orginial STL
 #ifndef OG
     #include "../containers/vector/vector.hpp"
+    #include "../containers/vector/soa_vector.hpp"
+    #include "../containers/vector/static_vector.hpp"
+    #include "../containers/deque/deque.hpp"
     #include "../containers/stack/stack.hpp"
+    #include "../containers/stack/concurrent_stack.hpp"
+    #include "../containers/queue/ring_queue.hpp"
+    #include "../containers/queue/mpmc_queue.hpp"
     #include "../containers/map/map.hpp"
+    #include "../containers/map/multimap.hpp"
+    #include "../containers/map/interval_map.hpp"
+    #include "../containers/map/balanced_map.hpp"
+    #include "../containers/map/int_map.hpp"
+    #include "../containers/map/concurrent_map.hpp"
+    #include "../containers/map/persistent_map.hpp"
     #include "../containers/set/set.hpp"
+    #include "../containers/set/multiset.hpp"
+    #include "../containers/set/int_set.hpp"
+    #include "../containers/string/string.hpp"
+
+    // maps and sets of char keys run with threaded nodes
+    namespace ft {
+        template <> struct threaded_nodes<char> { static const bool value = true; };
+    }
 #else
     #include <vector>
+    #include <deque>
     #include <stack>
+    #include <queue>
     #include <map>
     #include <set>
+    #include <iterator>
     namespace ft = std;
 #endif
 
@@ -25,8 +48,12 @@ void print_title(const char *s);
 void print_green(const char *s, int line = 0);
 
 void vector_all_tests();
+void deque_all_tests();
 void stack_all_tests();
+void queue_all_tests();
 void map_all_tests();
+void persistent_map_all_tests();
 void set_all_tests();
+void string_all_tests();
 
 #endif
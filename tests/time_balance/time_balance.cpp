@@ -0,0 +1,85 @@
+#include "../tests.hpp"
+#include "../timing.hpp"
+#include <cstdlib>
+#include <vector>
+#include <algorithm>
+
+#ifndef RSEED
+# define RSEED 44
+#endif
+
+#define SIZE    200000
+#define LOOKUPS 1000000
+
+// std has one balancing, each policy is compared to std::map
+#ifdef OG
+# define avl_map    map
+# define treap_map  map
+# define splay_map  map
+#endif
+
+// keys inserted, looked up, then half of them erased
+template <class Map>
+void workload(const std::vector<int> &keys, const std::vector<int> &lookups, const char *name){
+    Map mp;
+    long sum = 0;
+    long start = now_us();
+
+    for (size_t i = 0; i < keys.size(); ++i)
+        mp.insert(ft::make_pair(keys[i], static_cast<int>(i)));
+    for (size_t i = 0; i < lookups.size(); ++i){
+        typename Map::iterator it = mp.find(lookups[i]);
+        if (it != mp.end())
+            sum += it->second;
+    }
+    for (size_t i = 0; i < keys.size(); i += 2)
+        mp.erase(keys[i]);
+    long spent = now_us() - start;
+
+    std::cout << name << ": " << mp.size() << " left, sum " << sum << std::endl;
+    std::cerr << name << ": " << spent / 1000 << "ms | ";
+}
+
+void policies(const std::vector<int> &keys, const std::vector<int> &lookups, const char *name){
+    std::cout << name << std::endl;
+    std::cerr << std::endl << "    " << name << " | ";
+    workload<ft::map<int, int> >(keys, lookups, "rb");
+    workload<ft::avl_map<int, int> >(keys, lookups, "avl");
+    workload<ft::treap_map<int, int> >(keys, lookups, "treap");
+    workload<ft::splay_map<int, int> >(keys, lookups, "splay");
+}
+
+int main(){
+    srand(RSEED);
+    std::vector<int>    keys;
+    std::vector<int>    lookups;
+
+    // uniform: random keys and lookups
+    for (int i = 0; i < SIZE; ++i)
+        keys.push_back(rand() % (SIZE * 4));
+    for (int i = 0; i < LOOKUPS; ++i)
+        lookups.push_back(rand() % (SIZE * 4));
+    policies(keys, lookups, "uniform");
+
+    // sorted: keys and lookups in order
+    std::sort(keys.begin(), keys.end());
+    std::sort(lookups.begin(), lookups.end());
+    policies(keys, lookups, "sorted");
+
+    // zipf: random keys, the lookups go to a few hot ones
+    // (rank r drawn with probability 1 / r)
+    std::random_shuffle(keys.begin(), keys.end());
+    std::vector<double> cdf(SIZE);
+    double total = 0;
+    for (int r = 0; r < SIZE; ++r){
+        total += 1.0 / (r + 1);
+        cdf[r] = total;
+    }
+    for (int i = 0; i < LOOKUPS; ++i){
+        double x = total * rand() / RAND_MAX;
+        size_t r = std::lower_bound(cdf.begin(), cdf.end(), x) - cdf.begin();
+        lookups[i] = keys[r < keys.size() ? r : keys.size() - 1];
+    }
+    policies(keys, lookups, "zipf");
+    std::cerr << std::endl;
+}
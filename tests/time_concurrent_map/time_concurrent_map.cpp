@@ -0,0 +1,124 @@
+#include "../tests.hpp"
+#include <pthread.h>
+#include "../timing.hpp"
+#include <cstdlib>
+
+#define THREADS 4
+#define KEYS    (1 << 16)
+#define OPS     400000
+
+// std has no concurrent map, the reference is
+// what we used before: a std::map behind a mutex
+#ifdef OG
+template <class Key, class T>
+class locked_map {
+    typedef std::map<Key, T>    map_type;
+
+    map_type        _m;
+    pthread_mutex_t _mtx;
+
+    public:
+    typedef typename map_type::value_type       value_type;
+    typedef typename map_type::size_type        size_type;
+    typedef typename map_type::const_iterator   const_iterator;
+
+    locked_map() { pthread_mutex_init(&_mtx, NULL); }
+    ~locked_map() { pthread_mutex_destroy(&_mtx); }
+
+    void insert(const value_type& val) {
+        pthread_mutex_lock(&_mtx);
+        _m.insert(val);
+        pthread_mutex_unlock(&_mtx);
+    }
+
+    size_type erase(const Key& k) {
+        pthread_mutex_lock(&_mtx);
+        size_type ret = _m.erase(k);
+        pthread_mutex_unlock(&_mtx);
+        return ret;
+    }
+
+    size_type count(const Key& k) {
+        pthread_mutex_lock(&_mtx);
+        size_type ret = _m.count(k);
+        pthread_mutex_unlock(&_mtx);
+        return ret;
+    }
+
+    // only used once the threads are joined
+    size_type size() const { return _m.size(); }
+    const_iterator begin() const { return _m.begin(); }
+    const_iterator end() const { return _m.end(); }
+};
+typedef locked_map<long, long> map_type;
+#else
+typedef ft::concurrent_map<long, long> map_type;
+#endif
+
+struct worker_arg {
+    map_type    *m;
+    int         id;
+    int         threads;
+    long        found;
+};
+
+// 90% lookups, 5% inserts, 5% erases. Each thread works on the keys
+// equal to its id modulo the number of threads: lookups still cross
+// the whole map, but the final content doesn't depend on scheduling
+void *worker(void *p){
+    worker_arg      *arg = static_cast<worker_arg *>(p);
+    unsigned int    seed = arg->id + 1;
+
+    arg->found = 0;
+    for (long i = 0; i < OPS / arg->threads; ++i){
+        int  r = rand_r(&seed);
+        long key = (r >> 4) % KEYS;
+        key = key - key % arg->threads + arg->id;
+        switch (r % 20){
+            case 0:
+                arg->m->insert(ft::make_pair(key, key));
+                break;
+            case 1:
+                arg->m->erase(key);
+                break;
+            default:
+                arg->found += arg->m->count(key);
+        }
+    }
+    return NULL;
+}
+
+void shared_map(int threads){
+    map_type    m;
+    pthread_t   th[THREADS];
+    worker_arg  args[THREADS];
+    long        found = 0;
+    long        sum = 0;
+
+    for (long k = 0; k < KEYS; k += 2)
+        m.insert(ft::make_pair(k, k));
+    long start = now_us();
+    for (int i = 0; i < threads; ++i){
+        args[i].m = &m;
+        args[i].id = i;
+        args[i].threads = threads;
+        pthread_create(th + i, NULL, worker, args + i);
+    }
+    for (int i = 0; i < threads; ++i){
+        pthread_join(th[i], NULL);
+        found += args[i].found;
+    }
+    long spent = now_us() - start;
+
+    for (map_type::const_iterator it = m.begin(); it != m.end(); ++it)
+        sum += it->first;
+    std::cout << threads << " threads, found: " << found << ", size: "
+              << m.size() << ", key sum: " << sum << std::endl;
+    std::cerr << threads << " threads: "
+              << OPS * 1000L / (spent ? spent : 1) << " Kops/s | ";
+}
+
+int main(){
+    for (int threads = 1; threads <= THREADS; threads *= 2)
+        shared_map(threads);
+}
@@ -0,0 +1,102 @@
+#include "../tests.hpp"
+#include <pthread.h>
+#include "../timing.hpp"
+
+#define THREADS 4
+#define ROUNDS  20000
+#define BURST   64
+
+// std has no concurrent stack, the reference is
+// what we used before: a std::stack behind a mutex
+#ifdef OG
+template <class T>
+class locked_stack {
+    std::stack<T>   _s;
+    pthread_mutex_t _m;
+
+    public:
+    locked_stack() { pthread_mutex_init(&_m, NULL); }
+    ~locked_stack() { pthread_mutex_destroy(&_m); }
+
+    void push(const T& val) {
+        pthread_mutex_lock(&_m);
+        _s.push(val);
+        pthread_mutex_unlock(&_m);
+    }
+
+    bool try_pop(T& out) {
+        pthread_mutex_lock(&_m);
+        bool ret = !_s.empty();
+        if (ret) {
+            out = _s.top();
+            _s.pop();
+        }
+        pthread_mutex_unlock(&_m);
+        return ret;
+    }
+
+    bool empty() {
+        pthread_mutex_lock(&_m);
+        bool ret = _s.empty();
+        pthread_mutex_unlock(&_m);
+        return ret;
+    }
+};
+typedef locked_stack<long> stack_type;
+#else
+typedef ft::concurrent_stack<long> stack_type;
+#endif
+
+struct worker_arg {
+    stack_type  *s;
+    long        id;
+    long        popped_sum;
+};
+
+// Each thread pushes bursts of values then pops as many,
+// the values popped may have been pushed by any thread
+void *worker(void *p){
+    worker_arg *arg = static_cast<worker_arg *>(p);
+    long        val;
+
+    arg->popped_sum = 0;
+    for (long r = 0; r < ROUNDS; ++r){
+        for (long i = 0; i < BURST; ++i)
+            arg->s->push(arg->id * ROUNDS * BURST + r * BURST + i);
+        for (long i = 0; i < BURST; ++i){
+            while (!arg->s->try_pop(val))
+                ;
+            arg->popped_sum += val;
+        }
+    }
+    return NULL;
+}
+
+void shared_stack(int threads){
+    stack_type  s;
+    pthread_t   th[THREADS];
+    worker_arg  args[THREADS];
+    long        sum = 0;
+    long        start = now_us();
+
+    for (int i = 0; i < threads; ++i){
+        args[i].s = &s;
+        args[i].id = i;
+        pthread_create(th + i, NULL, worker, args + i);
+    }
+    for (int i = 0; i < threads; ++i){
+        pthread_join(th[i], NULL);
+        sum += args[i].popped_sum;
+    }
+    long spent = now_us() - start;
+
+    std::cout << threads << " threads, popped sum: " << sum
+              << ", empty: " << s.empty() << std::endl;
+    std::cerr << threads << " threads: "
+              << (threads * ROUNDS * BURST * 2L) / (spent ? spent : 1) << " Mops/s | ";
+}
+
+int main(){
+    for (int threads = 1; threads <= THREADS; threads *= 2)
+        shared_stack(threads);
+}
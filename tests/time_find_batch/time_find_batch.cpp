@@ -0,0 +1,54 @@
+#include "../tests.hpp"
+#include "../timing.hpp"
+#include <cstdlib>
+#include <vector>
+#include <algorithm>
+
+#ifndef RSEED
+# define RSEED 41
+#endif
+
+#define SIZE    1000000
+#define LOOKUPS 2000000
+
+typedef ft::map<int, int> map_type;
+
+// std has no batched lookup, the reference is a loop of find()
+void lookups(const map_type &mp, const std::vector<int> &keys, const char *name){
+    std::vector<map_type::const_iterator> found(keys.size());
+    long start = now_us();
+#ifdef OG
+    for (size_t i = 0; i < keys.size(); ++i)
+        found[i] = mp.find(keys[i]);
+#else
+    mp.find_batch(keys.begin(), keys.end(), found.begin());
+#endif
+    long spent = now_us() - start;
+
+    long sum = 0;
+    size_t hits = 0;
+    for (size_t i = 0; i < found.size(); ++i){
+        if (found[i] == mp.end())
+            continue;
+        ++hits;
+        sum += found[i]->second;
+    }
+    std::cout << name << ": " << hits << " found, sum " << sum << std::endl;
+    std::cerr << name << ": " << keys.size() * 1000L / (spent ? spent : 1) << " Klookups/s | ";
+}
+
+int main(){
+    srand(RSEED);
+    map_type            mp;
+    std::vector<int>    keys;
+
+    for (int i = 0; i < SIZE; ++i)
+        mp.insert(ft::make_pair(rand() % (SIZE * 2), i));
+    keys.reserve(LOOKUPS);
+    for (int i = 0; i < LOOKUPS; ++i)
+        keys.push_back(rand() % (SIZE * 2));
+    lookups(mp, keys, "random");
+    // keys close to each other stay in cache either way
+    std::sort(keys.begin(), keys.end());
+    lookups(mp, keys, "sorted");
+}
@@ -0,0 +1,87 @@
+#include "../tests.hpp"
+#include "../timing.hpp"
+#include <cstdlib>
+#include <vector>
+#include <algorithm>
+
+#ifndef RSEED
+# define RSEED 45
+#endif
+
+#define SIZE    500000
+#define LOOKUPS 2000000
+
+// std has no radix tree, int_map is compared to std::map
+#ifdef OG
+# define int_map    map
+#endif
+
+// keys inserted, looked up, scanned from lower_bound, then half of them erased
+template <class Map>
+void workload(const std::vector<int> &keys, const std::vector<int> &lookups, const char *name){
+    Map mp;
+    long sum = 0;
+    long start = now_us();
+
+    for (size_t i = 0; i < keys.size(); ++i)
+        mp.insert(ft::make_pair(keys[i], static_cast<int>(i)));
+    for (size_t i = 0; i < lookups.size(); ++i){
+        typename Map::iterator it = mp.find(lookups[i]);
+        if (it != mp.end())
+            sum += it->second;
+    }
+    for (size_t i = 0; i < lookups.size(); i += 64){
+        typename Map::iterator it = mp.lower_bound(lookups[i]);
+        for (int n = 0; n < 16 && it != mp.end(); ++n, ++it)
+            sum += it->first;
+    }
+    for (size_t i = 0; i < keys.size(); i += 2)
+        mp.erase(keys[i]);
+    long spent = now_us() - start;
+
+    std::cout << name << ": " << mp.size() << " left, sum " << sum << std::endl;
+    std::cerr << name << ": " << spent / 1000 << "ms | ";
+}
+
+void maps(const std::vector<int> &keys, const std::vector<int> &lookups, const char *name){
+    std::cout << name << std::endl;
+    std::cerr << std::endl << "    " << name << " | ";
+    workload<ft::map<int, int> >(keys, lookups, "map");
+    workload<ft::int_map<int, int> >(keys, lookups, "int_map");
+}
+
+// random order lookups, a quarter of them missing
+void draw_lookups(const std::vector<int> &keys, std::vector<int> &lookups){
+    lookups.clear();
+    for (int i = 0; i < LOOKUPS; ++i)
+        lookups.push_back(i % 4 ? keys[rand() % keys.size()] : rand());
+}
+
+int main(){
+    srand(RSEED);
+    std::vector<int>    keys;
+    std::vector<int>    lookups;
+
+    // dense: 0 to SIZE, inserted in random order
+    for (int i = 0; i < SIZE; ++i)
+        keys.push_back(i);
+    std::random_shuffle(keys.begin(), keys.end());
+    draw_lookups(keys, lookups);
+    maps(keys, lookups, "dense");
+
+    // clustered: runs of 64 close keys, far from each other
+    keys.clear();
+    for (int i = 0; i < SIZE; ++i)
+        keys.push_back((i / 64) * 100003 + (i % 64) * 3);
+    std::random_shuffle(keys.begin(), keys.end());
+    draw_lookups(keys, lookups);
+    maps(keys, lookups, "clustered");
+
+    // random: keys anywhere, positive and negative
+    keys.clear();
+    for (int i = 0; i < SIZE; ++i)
+        keys.push_back(rand() - RAND_MAX / 2);
+    draw_lookups(keys, lookups);
+    maps(keys, lookups, "random");
+    std::cerr << std::endl;
+}
@@ -0,0 +1,117 @@
+#include "../tests.hpp"
+#include "../timing.hpp"
+#include <cstdlib>
+#include <vector>
+#include <algorithm>
+#include <memory>
+
+#ifndef RSEED
+# define RSEED 46
+#endif
+
+#define CLUSTERS    500
+#define PER_CLUSTER 400
+#define LOOKUPS     400000
+
+#ifdef OG
+# define SET_OP(name, a, b, out) \
+    std::name(a.begin(), a.end(), b.begin(), b.end(), std::inserter(out, out.end()))
+#else
+# define SET_OP(name, a, b, out) out = ft::name(a, b)
+#endif
+
+// bytes held by the containers using it
+long g_bytes = 0;
+
+template <class T>
+struct counting_alloc : std::allocator<T> {
+    template <class U> struct rebind { typedef counting_alloc<U> other; };
+
+    counting_alloc() {}
+    counting_alloc(const counting_alloc &): std::allocator<T>() {}
+    template <class U> counting_alloc(const counting_alloc<U> &) {}
+
+    T *allocate(std::size_t n, const void * = 0) {
+        g_bytes += n * sizeof(T);
+        return std::allocator<T>::allocate(n);
+    }
+    void deallocate(T *p, std::size_t n) {
+        g_bytes -= n * sizeof(T);
+        std::allocator<T>::deallocate(p, n);
+    }
+};
+
+// std has no compressed set, int_set is compared to std::set
+#ifdef OG
+typedef std::set<int, std::less<int>, counting_alloc<int> >  int_set_type;
+#else
+typedef ft::int_set<int, counting_alloc<int> >              int_set_type;
+#endif
+
+// ids inserted, looked up, scanned, then united and intersected with
+// the other ids
+template <class Set>
+void workload(const std::vector<int> &ids, const std::vector<int> &other,
+              const std::vector<int> &lookups, const char *name, bool show_bytes){
+    long sum = 0;
+    long start = now_us();
+    long bytes = g_bytes;
+    {
+        Set s(ids.begin(), ids.end());
+        Set o(other.begin(), other.end());
+        bytes = g_bytes - bytes;
+        for (size_t i = 0; i < lookups.size(); ++i)
+            sum += s.count(lookups[i]);
+        for (typename Set::const_iterator it = s.begin(); it != s.end(); ++it)
+            sum += *it & 0xff;
+        Set u, in;
+        SET_OP(set_union, s, o, u);
+        SET_OP(set_intersection, s, o, in);
+        std::cout << name << ": " << s.size() << ' ' << u.size() << ' ' << in.size()
+                  << ", sum " << sum << std::endl;
+    }
+    long spent = now_us() - start;
+
+    std::cerr << name << ": " << spent / 1000 << "ms";
+    // the tree of ft::set makes its nodes without the allocator
+    if (show_bytes)
+        std::cerr << ", " << bytes / (ids.size() + other.size()) << " bytes/key";
+    std::cerr << " | ";
+}
+
+void sets(const std::vector<int> &ids, const std::vector<int> &other,
+          const std::vector<int> &lookups, const char *name){
+    std::cout << name << std::endl;
+    std::cerr << std::endl << "    " << name << " | ";
+    workload<ft::set<int> >(ids, other, lookups, "set", false);
+    workload<int_set_type>(ids, other, lookups, "int_set", true);
+}
+
+// ids in CLUSTERS groups of PER_CLUSTER, one every step in a group
+void draw_ids(std::vector<int> &ids, int step){
+    ids.clear();
+    for (int c = 0; c < CLUSTERS; ++c){
+        int base = rand() % 2000000000 - 1000000000;
+        for (int i = 0; i < PER_CLUSTER; ++i)
+            ids.push_back(base + i * step);
+    }
+    std::random_shuffle(ids.begin(), ids.end());
+}
+
+int main(){
+    srand(RSEED);
+    std::vector<int>    ids;
+    std::vector<int>    other;
+    std::vector<int>    lookups;
+
+    for (int step = 1; step <= 16; step *= 4){
+        draw_ids(ids, step);
+        draw_ids(other, step);
+        other.insert(other.end(), ids.begin(), ids.begin() + ids.size() / 2);
+        lookups.clear();
+        for (int i = 0; i < LOOKUPS; ++i)
+            lookups.push_back(i % 2 ? ids[rand() % ids.size()] : ids[rand() % ids.size()] + 1);
+        sets(ids, other, lookups, step == 1 ? "consecutive" : step == 4 ? "step 4" : "step 16");
+    }
+    std::cerr << std::endl;
+}
@@ -0,0 +1,64 @@
+#include "../tests.hpp"
+#include "../timing.hpp"
+#include <cstdlib>
+#include <vector>
+#include <iterator>
+
+#ifndef RSEED
+# define RSEED 43
+#endif
+
+#define SIZE    200000
+#define QUERIES 400
+#define SPAN    (SIZE * 50)
+
+// std has no interval map, the reference scans a multimap of pairs
+#ifdef OG
+typedef ft::multimap<ft::pair<int, int>, int> map_type;
+#else
+typedef ft::interval_map<int, int> map_type;
+#endif
+
+// intervals of [lo, lo + len), or containing lo when len is 0
+void queries(const map_type &mp, const std::vector<int> &los, int len, const char *name){
+    std::vector<map_type::const_iterator> found;
+    long sum = 0;
+    long start = now_us();
+    for (size_t i = 0; i < los.size(); ++i){
+        found.clear();
+#ifdef OG
+        int hi = los[i] + len;
+        for (map_type::const_iterator it = mp.begin(); it != mp.end(); ++it)
+            if ((len ? it->first.first < hi : it->first.first <= hi) && los[i] < it->first.second)
+                found.push_back(it);
+#else
+        if (len)
+            mp.overlap(los[i], los[i] + len, std::back_inserter(found));
+        else
+            mp.stab(los[i], std::back_inserter(found));
+#endif
+        for (size_t j = 0; j < found.size(); ++j)
+            sum += found[j]->second;
+    }
+    long spent = now_us() - start;
+
+    std::cout << name << ": sum " << sum << std::endl;
+    std::cerr << name << ": " << los.size() * 1000000L / (spent ? spent : 1) << " queries/s | ";
+}
+
+int main(){
+    srand(RSEED);
+    map_type            mp;
+    std::vector<int>    los;
+
+    // mostly short intervals, a few long ones
+    for (int i = 0; i < SIZE; ++i){
+        int lo = rand() % SPAN;
+        int len = (i % 100) ? rand() % 200 + 1 : rand() % (SPAN / 20) + 1;
+        mp.insert(ft::make_pair(ft::make_pair(lo, lo + len), i));
+    }
+    for (int i = 0; i < QUERIES; ++i)
+        los.push_back(rand() % SPAN);
+    queries(mp, los, 0, "stab");
+    queries(mp, los, 1000, "overlap");
+}
@@ -1,4 +1,7 @@
 #include "../tests.hpp"
+#include "../timing.hpp"
+#include <cstdio>
+#include <vector>
 
 #ifndef RSEED
 # define RSEED 89
@@ -30,7 +33,47 @@ void large_map(){
 
 }
 
+// Maps keyed by strings: keys inserted, looked up, the map copied,
+// then a part of them erased
+template <class Str>
+void string_map(const std::vector<std::string> &keys, const char *name){
+    typedef ft::map<Str, int> maps;
+    long start = now_us();
+    long sum = 0;
+    {
+        std::vector<Str> k;
+        for (size_t i = 0; i < keys.size(); ++i)
+            k.push_back(Str(keys[i].c_str()));
+
+        maps mp;
+        for (size_t i = 0; i < k.size(); ++i)
+            mp.insert(ft::make_pair(k[i], (int)i));
+        for (size_t i = 0; i < k.size(); i += 3)
+            sum += mp.count(k[(i * 7) % k.size()]);
+        maps cpy(mp);
+        for (size_t i = 0; i < k.size(); i += 2)
+            cpy.erase(k[i]);
+        sum += mp.size() + cpy.size() + cpy.begin()->second;
+    }
+    std::cout << "string keys: " << sum << std::endl;
+    std::cerr << name << ": " << (now_us() - start) / 1000 << "ms | ";
+}
+
 int main(){
     srand(RSEED);
     large_map();
+
+    std::vector<std::string> keys;
+    char buf[32];
+    for (int i = 0; i < 100000; ++i) {
+        sprintf(buf, "user_%d", rand() % MAX_K);
+        keys.push_back(buf);
+    }
+    // both orders: the one run second is slowed by the heap of the first
+    std::cerr << std::endl << "    ";
+    string_map<std::string>(keys, "map<std::string>");
+    string_map<ft::string>(keys, "map<ft::string>");
+    string_map<ft::string>(keys, "map<ft::string>");
+    string_map<std::string>(keys, "map<std::string>");
+    std::cerr << std::endl;
 }
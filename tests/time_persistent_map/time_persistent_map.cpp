@@ -0,0 +1,59 @@
+#include "../tests.hpp"
+#include "../timing.hpp"
+#include <cstdlib>
+#include <vector>
+
+#ifndef RSEED
+# define RSEED 89
+#endif
+
+#define SIZE        100000
+#define VERSIONS    50
+#define UPDATES     50
+
+// std has no persistent map, the reference is
+// what we used before: copying the whole std::map
+#ifdef OG
+typedef std::map<int, int>              map_type;
+#else
+typedef ft::persistent_map<int, int>    map_type;
+#endif
+
+// A writer keeps changing the map and hands a snapshot
+// to readers every UPDATES changes, all of them are kept alive
+void snapshots(){
+    map_type                mp;
+    std::vector<map_type>   versions;
+    long                    sum = 0;
+
+    for (int i = 0; i < SIZE; ++i)
+        mp.insert(ft::make_pair(rand() % (SIZE * 4), i));
+
+    long start = now_us();
+    versions.reserve(VERSIONS);
+    for (int v = 0; v < VERSIONS; ++v){
+        versions.push_back(mp);
+        for (int i = 0; i < UPDATES; ++i){
+            mp.erase(rand() % (SIZE * 4));
+            mp.insert(ft::make_pair(rand() % (SIZE * 4), v));
+        }
+    }
+    long spent = now_us() - start;
+
+    // readers: every version still holds what it had when taken
+    for (int v = 0; v < VERSIONS; v += VERSIONS / 10){
+        long vsum = 0;
+        for (map_type::const_iterator it = versions[v].begin(); it != versions[v].end(); ++it)
+            vsum += it->first - it->second;
+        std::cout << "version " << v << ": size " << versions[v].size()
+                  << ", sum " << vsum << std::endl;
+        sum += vsum;
+    }
+    std::cout << "total " << sum << std::endl;
+    std::cerr << VERSIONS << " snapshots: " << spent / 1000 << "ms | ";
+}
+
+int main(){
+    srand(RSEED);
+    snapshots();
+}
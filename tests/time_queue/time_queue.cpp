@@ -0,0 +1,120 @@
+#include "../tests.hpp"
+#include <pthread.h>
+#include "../timing.hpp"
+
+#define MAX_THREADS 4
+#define ITEMS       400000
+#define CAPACITY    1024
+
+// std has no concurrent queue, the reference is
+// what we used before: a std::queue behind a mutex
+#ifdef OG
+template <class T>
+class locked_queue {
+    std::queue<T>   _q;
+    pthread_mutex_t _m;
+
+    public:
+    explicit locked_queue(size_t) { pthread_mutex_init(&_m, NULL); }
+    ~locked_queue() { pthread_mutex_destroy(&_m); }
+
+    void push(const T& val) {
+        pthread_mutex_lock(&_m);
+        _q.push(val);
+        pthread_mutex_unlock(&_m);
+    }
+
+    void pop(T& out) {
+        while (true) {
+            pthread_mutex_lock(&_m);
+            if (!_q.empty()) {
+                out = _q.front();
+                _q.pop();
+                pthread_mutex_unlock(&_m);
+                return;
+            }
+            pthread_mutex_unlock(&_m);
+        }
+    }
+};
+typedef std::queue<long>        ring_type;
+typedef locked_queue<long>      shared_type;
+#else
+typedef ft::ring_queue<long>    ring_type;
+typedef ft::mpmc_queue<long>    shared_type;
+#endif
+
+// Single thread FIFO, the queue keeps growing and shrinking
+void large_ring(){
+    ring_type q;
+    long      sum = 0;
+
+    for (long r = 0; r < 100; ++r){
+        for (long i = 0; i < 50000; ++i)
+            q.push(r * i);
+        for (long i = 0; i < 49000; ++i){
+            sum += q.front();
+            q.pop();
+        }
+    }
+    std::cout << q.size() << ' ' << sum << std::endl;
+}
+
+struct worker_arg {
+    shared_type *q;
+    long        count;
+    long        sum;
+};
+
+void *producer(void *p){
+    worker_arg *arg = static_cast<worker_arg *>(p);
+    for (long i = 0; i < arg->count; ++i)
+        arg->q->push(i);
+    return NULL;
+}
+
+void *consumer(void *p){
+    worker_arg *arg = static_cast<worker_arg *>(p);
+    long        val;
+
+    arg->sum = 0;
+    for (long i = 0; i < arg->count; ++i){
+        arg->q->pop(val);
+        arg->sum += val;
+    }
+    return NULL;
+}
+
+// n producers and n consumers go through the same queue
+void pipeline(int n){
+    shared_type q(CAPACITY);
+    pthread_t   th[MAX_THREADS * 2];
+    worker_arg  args[MAX_THREADS * 2];
+    long        sum = 0;
+    long        start = now_us();
+
+    for (int i = 0; i < n; ++i){
+        args[i].q = &q;
+        args[i].count = ITEMS / n;
+        pthread_create(th + i, NULL, producer, args + i);
+        args[n + i].q = &q;
+        args[n + i].count = ITEMS / n;
+        pthread_create(th + n + i, NULL, consumer, args + n + i);
+    }
+    for (int i = 0; i < n * 2; ++i){
+        pthread_join(th[i], NULL);
+        if (i >= n)
+            sum += args[i].sum;
+    }
+    long spent = now_us() - start;
+
+    std::cout << n << " producers/consumers, sum: " << sum << std::endl;
+    std::cerr << n << "x" << n << ": "
+              << ITEMS / (spent ? spent : 1) << " Mitems/s | ";
+}
+
+int main(){
+    large_ring();
+    for (int n = 1; n <= MAX_THREADS; n *= 2)
+        pipeline(n);
+}
@@ -0,0 +1,52 @@
+#include "../tests.hpp"
+#include "../timing.hpp"
+
+#ifndef SIZE
+# define SIZE   10000000
+#endif
+#define SCANS   3
+
+// int keys get threaded nodes, long keys keep parent links only
+#ifndef OG
+namespace ft {
+    template <> struct threaded_nodes<int> { static const bool value = true; };
+}
+#endif
+
+// full scans forward and backward, the map is built in order
+template <class Map>
+void scan(const char *name){
+    Map     mp;
+    long    sum = 0;
+
+#ifdef OG
+    for (int i = 0; i < SIZE; ++i)
+        mp.insert(mp.end(), ft::make_pair(i * 3, i));
+#else
+    {
+        ft::vector<ft::pair<typename Map::key_type, int> > vals;
+        vals.reserve(SIZE);
+        for (int i = 0; i < SIZE; ++i)
+            vals.push_back(ft::make_pair(i * 3, i));
+        mp.insert_batch(vals.begin(), vals.end());
+    }
+#endif
+    // the bounds are taken out of the loops, only the steps are timed
+    typename Map::const_iterator            end = mp.end();
+    typename Map::const_reverse_iterator    rend = mp.rend();
+    long start = now_us();
+    for (int s = 0; s < SCANS; ++s){
+        for (typename Map::const_iterator it = mp.begin(); it != end; ++it)
+            sum += it->second;
+        for (typename Map::const_reverse_iterator it = mp.rbegin(); it != rend; ++it)
+            sum -= it->first;
+    }
+    long spent = now_us() - start;
+    std::cout << name << ": " << mp.size() << " elements, sum " << sum << std::endl;
+    std::cerr << name << ": " << SIZE * 2L * SCANS / (spent ? spent : 1) << " Msteps/s | ";
+}
+
+int main(){
+    scan<ft::map<int, int> >("threaded");
+    scan<ft::map<long, int> >("parent links");
+}
@@ -30,7 +30,75 @@ void large_set(){
 
 }
 
+#ifdef OG
+// std has algorithms on sorted ranges, inserting in a new set
+# define SET_OP(name, a, b, out) \
+    std::name(a.begin(), a.end(), b.begin(), b.end(), std::inserter(out, out.end()))
+#else
+# define SET_OP(name, a, b, out) ft::name(a, b).swap(out)
+#endif
+
+void set_algebra(){
+    typedef ft::set<int> seti;
+    seti a;
+    seti b;
+    seti small;
+
+    for (int i = 0; i < 199999; ++i){
+        a.insert(rand() % 400000);
+        b.insert(rand() % 400000);
+    }
+    for (int i = 0; i < 99; ++i)
+        small.insert(rand() % 400000);
+
+    for (int i = 0; i < 5; ++i){
+        seti u, in, d, in_small;
+        SET_OP(set_union, a, b, u);
+        SET_OP(set_intersection, a, b, in);
+        SET_OP(set_difference, a, b, d);
+        SET_OP(set_intersection, a, small, in_small);
+        std::cout << u.size() << ' ' << in.size() << ' ' << d.size() << ' '
+                  << in_small.size() << std::endl;
+    }
+}
+
+#ifdef OG
+// std merges by inserting every element
+# define P_UNION(s, other) s.insert(other.begin(), other.end()); other.clear()
+# define P_DIFFERENCE(s, other) \
+    for (seti::iterator it = other.begin(); it != other.end(); ++it) s.erase(*it); \
+    other.clear()
+# define INSERT_BATCH(s, first, last) s.insert(first, last)
+#else
+# define P_UNION(s, other) s.parallel_union(other)
+# define P_DIFFERENCE(s, other) s.parallel_difference(other)
+# define INSERT_BATCH(s, first, last) s.insert_batch(first, last)
+#endif
+
+// a large set updated by batches, merged in place
+void set_batches(){
+    typedef ft::set<int> seti;
+    seti        large;
+    static int  batch[50000];
+
+    for (int round = 0; round < 20; ++round){
+        for (int i = 0; i < 50000; ++i)
+            batch[i] = rand() % 2000000;
+        INSERT_BATCH(large, batch, batch + 50000);
+        seti other;
+        for (int i = 0; i < 20000; ++i)
+            other.insert(rand() % 2000000);
+        P_UNION(large, other);
+        for (int i = 0; i < 20000; ++i)
+            other.insert(rand() % 2000000);
+        P_DIFFERENCE(large, other);
+    }
+    std::cout << large.size() << ' ' << *large.begin() << ' ' << *large.rbegin() << std::endl;
+}
+
 int main(){
     srand(RSEED);
     large_set();
+    set_algebra();
+    set_batches();
 }
@@ -0,0 +1,79 @@
+#include "../tests.hpp"
+#include "../timing.hpp"
+#include <cstdlib>
+#include <vector>
+
+#ifndef RSEED
+# define RSEED 48
+#endif
+
+#define RECORDS (1 << 21)
+#define SCANS   20
+
+typedef ft::vector<ft::pair<int, double> >  aos_type;
+
+// std has no soa_vector, it is compared to a vector of pairs
+#ifdef OG
+typedef std::vector<std::pair<int, double> >    soa_type;
+#else
+typedef ft::soa_vector<int, double>             soa_type;
+#endif
+
+// ids over a threshold counted, through the iterators
+template <class Vec>
+long scan_ids(const Vec &v, int threshold){
+    long ret = 0;
+    for (typename Vec::const_iterator it = v.begin(); it != v.end(); ++it)
+        ret += it->first > threshold;
+    return ret;
+}
+
+#ifndef OG
+// same scan over the column of ids alone
+long scan_ids(const soa_type &v, int threshold){
+    const int   *ids = v.firsts();
+    long        ret = 0;
+    for (size_t i = 0; i < v.size(); ++i)
+        ret += ids[i] > threshold;
+    return ret;
+}
+#endif
+
+// records built, scanned on the ids SCANS times, then on both fields
+template <class Vec>
+void workload(const std::vector<int> &ids, const char *name){
+    long start = now_us();
+    Vec v;
+    for (size_t i = 0; i < ids.size(); ++i)
+        v.push_back(ft::make_pair(ids[i], ids[i] * 0.5));
+    long built = now_us();
+
+    long hits = 0;
+    for (int s = 0; s < SCANS; ++s)
+        hits += scan_ids(v, s * (RAND_MAX / SCANS));
+    long scanned = now_us();
+
+    double total = 0;
+    for (typename Vec::const_iterator it = v.begin(); it != v.end(); ++it)
+        if (it->first & 1)
+            total += it->second;
+    long end = now_us();
+
+    std::cout << name << ": " << hits << ' ' << (long)total << std::endl;
+    std::cerr << name << ": build " << (built - start) / 1000 << "ms, id scans "
+              << (scanned - built) / 1000 << "ms, both fields "
+              << (end - scanned) / 1000 << "ms | ";
+}
+
+int main(){
+    srand(RSEED);
+    std::vector<int> ids;
+    for (int i = 0; i < RECORDS; ++i)
+        ids.push_back(rand());
+
+    std::cerr << std::endl << "    ";
+    workload<aos_type>(ids, "vector<pair>");
+    std::cerr << std::endl << "    ";
+    workload<soa_type>(ids, "soa_vector");
+    std::cerr << std::endl;
+}
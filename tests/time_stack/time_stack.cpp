@@ -1,4 +1,5 @@
 #include "../tests.hpp"
+#include "../timing.hpp"
 
 void large_stack(){
     ft::stack<int> ls;
@@ -11,7 +12,26 @@ void large_stack(){
         ls.pop();
 }
 
+// Pushes n elements and reports the slowest single push on stderr,
+// so the output comparison between ft and std is not affected
+template <class stack>
+void tail_latency(const char *name, int n){
+    stack s;
+    long worst = 0;
+
+    for (int i = 0; i < n; ++i){
+        long start = now_us();
+        s.push(i);
+        long spent = now_us() - start;
+        if (spent > worst)
+            worst = spent;
+    }
+    std::cout << std::endl << s.size() << ' ' << s.top() << std::endl;
+    std::cerr << name << " worst push: " << worst << "us | ";
+}
 
 int main(){
     large_stack();
+    tail_latency<ft::stack<int, ft::vector<int> > >("vector", 20000000);
+    tail_latency<ft::stack<int, ft::deque<int> > >("deque", 20000000);
 }
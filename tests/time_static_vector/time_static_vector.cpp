@@ -0,0 +1,52 @@
+#include "../tests.hpp"
+#include "../timing.hpp"
+#include <cstdlib>
+#include <vector>
+
+#ifndef RSEED
+# define RSEED 49
+#endif
+
+#define CELLS   (1 << 20)
+#define ROUNDS  1
+
+// std has no static_vector, it is compared to a vector
+#ifdef OG
+typedef std::vector<int>            static_type;
+#else
+typedef ft::static_vector<int, 8>   static_type;
+#endif
+
+// For each cell of a grid, its live neighbours gathered in a temporary
+// vector, at most 8 of them, then sorted and summed
+template <class Vec>
+void workload(const std::vector<char> &grid, int width, const char *name){
+    long start = now_us();
+    long sum = 0;
+
+    for (int r = 0; r < ROUNDS; ++r)
+        for (int c = width + 1; c < (int)grid.size() - width - 1; ++c) {
+            Vec near;
+            for (int dy = -1; dy <= 1; ++dy)
+                for (int dx = -1; dx <= 1; ++dx)
+                    if ((dy || dx) && grid[c + dy * width + dx])
+                        near.push_back(c + dy * width + dx);
+            if (near.size() > 1)
+                near.erase(near.begin());
+            sum += near.size() + (near.empty() ? 0 : near.back() & 7);
+        }
+    std::cout << name << ": " << sum << std::endl;
+    std::cerr << name << ": " << (now_us() - start) / 1000 << "ms | ";
+}
+
+int main(){
+    srand(RSEED);
+    std::vector<char> grid;
+    for (int i = 0; i < CELLS; ++i)
+        grid.push_back(rand() % 3 == 0);
+
+    std::cerr << std::endl << "    ";
+    workload<ft::vector<int> >(grid, 1024, "vector");
+    workload<static_type>(grid, 1024, "static_vector");
+    std::cerr << std::endl;
+}
@@ -0,0 +1,89 @@
+#include "../tests.hpp"
+#include "../timing.hpp"
+#include <cstdlib>
+#include <vector>
+#include <algorithm>
+
+#ifndef RSEED
+# define RSEED 47
+#endif
+
+#define BITS    (1 << 22)
+#define ROUNDS  6
+#define INSERTS 500
+
+// count and find_next aren't in std::vector<bool>
+#ifdef OG
+# define BITS_COUNT(v)      std::count(v.begin(), v.end(), true)
+# define BITS_NEXT(v, pos)  (std::find(v.begin() + pos + 1, v.end(), true) - v.begin())
+#else
+# define BITS_COUNT(v)      v.count()
+# define BITS_NEXT(v, pos)  v.find_next(pos)
+#endif
+
+typedef ft::vector<bool>    bits;
+
+void timed(const char *name, long start){
+    std::cerr << name << ": " << (now_us() - start) / 1000 << "ms | ";
+}
+
+// sieve of Eratosthenes, then the primes found one by one
+void sieve(){
+    long start = now_us();
+    bits    prime(BITS, true);
+    long    sum = 0;
+
+    prime[0] = false;
+    prime[1] = false;
+    for (size_t i = 2; i * i < prime.size(); ++i)
+        if (prime[i])
+            for (size_t j = i * i; j < prime.size(); j += i)
+                prime[j] = false;
+    for (size_t i = 2; i < prime.size(); i = BITS_NEXT(prime, i))
+        sum += i & 0xff;
+    std::cout << "sieve: " << BITS_COUNT(prime) << " primes, sum " << sum << std::endl;
+    timed("sieve", start);
+}
+
+// whole vectors filled, copied, compared and counted
+void bulk(){
+    long start = now_us();
+    bits    a(BITS, false);
+    long    sum = 0;
+
+    for (int r = 0; r < ROUNDS; ++r){
+        a.assign(BITS - r, r % 2);
+        a[rand() % a.size()].flip();
+        bits b(a);
+        b.back() = !b.back();
+        sum += (a == b) + (a < b) * 2 + BITS_COUNT(b);
+    }
+    std::cout << "bulk: " << sum << std::endl;
+    timed("bulk", start);
+}
+
+// bits inserted and erased near the front, everything after them moves
+void shifts(){
+    long start = now_us();
+    bits    a(BITS / 16, false);
+    long    sum = 0;
+
+    for (int i = 0; i < INSERTS; ++i){
+        a.insert(a.begin() + rand() % 100, rand() % 2);
+        if (i % 3 == 0)
+            a.erase(a.begin() + rand() % 100);
+    }
+    for (size_t i = 0; i < 200; ++i)
+        sum += a[i] << (i % 8);
+    std::cout << "shifts: " << a.size() << ' ' << sum << std::endl;
+    timed("shifts", start);
+}
+
+int main(){
+    srand(RSEED);
+    std::cerr << std::endl << "    ";
+    sieve();
+    bulk();
+    shifts();
+    std::cerr << std::endl;
+}
@@ -0,0 +1,13 @@
+#ifndef TIMING_HPP
+# define TIMING_HPP
+
+#include <sys/time.h>
+
+// microseconds since epoch, the clock of the time_ benchmarks
+inline long now_us(){
+    struct timeval tv;
+    gettimeofday(&tv, NULL);
+    return tv.tv_sec * 1000000L + tv.tv_usec;
+}
+
+#endif